@@ -24,14 +24,20 @@
  *
  * INCLUDED COMPONENTS:
  * - TMP.hpp: Template metaprogramming utilities
+ * - barrett.hpp: Barrett reduction for a fixed modulus
  * - basic_N.hpp: Arbitrary-precision unsigned integers
  * - basic_Z.hpp: Arbitrary-precision signed integers
  * - basic_Q.hpp: Arbitrary-precision rational numbers
  * - calc.hpp: Mathematical calculation functions (GCD, sqrt, pow, etc.)
+ * - crt_basis.hpp: Chinese remainder reconstruction for fixed moduli
  * - error.hpp: Exception types
+ * - expression.hpp: Opt-in expression templates (expr::lazy)
+ * - fixed_base_pow.hpp: Powers of a fixed base with precomputed comb tables
  * - hash.hpp: std::hash specializations for unordered containers
  * - literals.hpp: User-defined literals (_N, _Z, _Q)
+ * - montgomery.hpp: Montgomery multiplication for odd moduli
  * - rand.hpp: Random number generation
+ * - tracking_allocator.hpp: Counting allocator and allocation statistics
  * - uint.hpp: Fixed-size unsigned integers
  * - constants_and_types.hpp: Type aliases and constants
  * - declarations.hpp: Forward declarations
@@ -52,14 +58,20 @@
 #pragma once
 
 #include "TMP.hpp"
+#include "barrett.hpp"
 #include "basic_N.hpp"
 #include "basic_Q.hpp"
 #include "basic_Z.hpp"
 #include "calc.hpp"
 #include "constants_and_types.hpp"
+#include "crt_basis.hpp"
 #include "declarations.hpp"
 #include "error.hpp"
+#include "expression.hpp"
+#include "fixed_base_pow.hpp"
 #include "hash.hpp"
 #include "literals.hpp"
+#include "montgomery.hpp"
 #include "rand.hpp"
+#include "tracking_allocator.hpp"
 #include "uint.hpp"
@@ -0,0 +1,108 @@
+// The jmaths library for C++
+// Copyright (C) 2025  Jasper de Smaele
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "TMP.hpp"
+#include "constants_and_types.hpp"
+#include "declarations.hpp"
+
+/**
+ * @file barrett.hpp
+ * @brief Barrett reduction for repeated reductions by the same modulus
+ *
+ * With k the bit length of the modulus m, the quotient of x < m² by m is estimated as
+ *     q = ((x >> (k - 1)) × μ) >> (k + 1)    with μ = floor(4^k / m)
+ * which is at most 2 below the true quotient. x - q × m therefore only needs up to two
+ * corrective subtractions, and the reduction costs two multiplications instead of a
+ * long division.
+ *
+ * Unlike montgomery_context, any nonzero modulus is accepted (calc::pow_mod uses this
+ * context for even moduli) and numbers stay in their ordinary representation.
+ *
+ * USAGE:
+ * ```cpp
+ * const jmaths::barrett_context ctx(modulus);
+ * for (auto & x : values) { x = ctx.reduce(std::move(x)); }  // every x < modulus²
+ * N r = ctx.pow(base, exponent);                             // same as calc::pow_mod
+ * ```
+ *
+ * THREAD SAFETY: A context is immutable after construction and can be shared.
+ */
+
+namespace jmaths {
+
+/**
+ * @class barrett_context
+ * @brief Precomputed reciprocal for Barrett reduction by a fixed modulus
+ * @tparam basic_N_type basic_N type of the modulus and operands
+ */
+template <TMP::instance_of<basic_N> basic_N_type> class barrett_context {
+   public:
+    /**
+     * @brief Precompute μ = floor(4^k / mod) with k = mod.bits()
+     * @param mod The modulus
+     * @throws error::division_by_zero if mod is zero
+     */
+    explicit constexpr barrett_context(const basic_N_type & mod);
+
+    /**
+     * @brief The modulus m
+     */
+    [[nodiscard]] constexpr const basic_N_type & modulus() const;
+
+    /**
+     * @brief Reduce a number modulo m
+     * @param x Number to reduce (Barrett reduction if x < 4^k, long division otherwise)
+     * @return x mod m
+     * COMPLEXITY: Two multiplications of k-bit numbers for x < 4^k
+     */
+    [[nodiscard]] constexpr basic_N_type reduce(basic_N_type x) const;
+
+    /**
+     * @brief Modular multiplication
+     * @param a First factor (a < m)
+     * @param b Second factor (b < m)
+     * @return a × b mod m
+     */
+    [[nodiscard]] constexpr basic_N_type mul(const basic_N_type & a, const basic_N_type & b) const;
+
+    /**
+     * @brief Modular exponentiation with Barrett reduction
+     * @param base The base (any size, it is reduced modulo m first)
+     * @param exponent The exponent
+     * @return base^exponent mod m
+     *
+     * ALGORITHM: Sliding-window exponentiation (see sliding_window.hpp), every square and
+     * product is reduced in place
+     */
+    [[nodiscard]] constexpr basic_N_type pow(const basic_N_type & base,
+                                             const basic_N_type & exponent) const;
+
+   private:
+    basic_N_type mod_;
+    basic_N_type mu_;  // floor(4^k / m)
+    bitcount_t k_;     // bit length of m
+
+    /**
+     * @brief x = x mod m, with quotient as a reusable scratch number
+     */
+    constexpr void reduce_assign_(basic_N_type & x, basic_N_type & quotient) const;
+};
+
+}  // namespace jmaths
+
+#include "barrett_impl.hpp"
@@ -0,0 +1,127 @@
+// The jmaths library for C++
+// Copyright (C) 2025  Jasper de Smaele
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cassert>
+#include <utility>
+
+#include "TMP.hpp"
+#include "barrett.hpp"
+#include "basic_N.hpp"
+#include "constants_and_types.hpp"
+#include "def.hh"
+#include "error.hpp"
+#include "sliding_window.hpp"
+
+// member functions of barrett_context
+namespace jmaths {
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr barrett_context<basic_N_type>::barrett_context(const basic_N_type & mod) :
+    mod_(mod), k_(mod.bits()) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    error::division_by_zero::check(mod_);
+
+    mu_ = basic_N_type::detail::opr_div(basic_N_type::one_ << 2U * k_, mod_).first;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto barrett_context<basic_N_type>::modulus() const -> const basic_N_type & {
+    JMATHS_FUNCTION_TO_LOG;
+
+    return mod_;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type barrett_context<basic_N_type>::reduce(basic_N_type x) const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    basic_N_type quotient;
+    reduce_assign_(x, quotient);
+
+    return x;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type barrett_context<basic_N_type>::mul(const basic_N_type & a,
+                                                          const basic_N_type & b) const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    basic_N_type product = a;
+    product.opr_mult_assign_(b);
+
+    return reduce(std::move(product));
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type barrett_context<basic_N_type>::pow(const basic_N_type & base,
+                                                          const basic_N_type & exponent) const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    basic_N_type quotient;
+
+    basic_N_type base_num = base;
+    reduce_assign_(base_num, quotient);
+
+    // 1 mod m, which is 0 for m == 1
+    basic_N_type one = mod_.is_one() ? basic_N_type{} : basic_N_type::one_;
+
+    return internal::sliding_window_pow(
+        base_num,
+        exponent,
+        std::move(one),
+        [&](basic_N_type & x) {
+            x.opr_mult_assign_(x);
+            reduce_assign_(x, quotient);
+        },
+        [&](basic_N_type & x, const basic_N_type & y) {
+            x.opr_mult_assign_(y);
+            reduce_assign_(x, quotient);
+        });
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr void barrett_context<basic_N_type>::reduce_assign_(basic_N_type & x,
+                                                             basic_N_type & quotient) const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // ALGORITHM: Barrett reduction (HAC 14.42, with bit instead of digit shifts)
+    // For x < 4^k:
+    //     q = ((x >> (k - 1)) × μ) >> (k + 1)
+    // underestimates floor(x / m) by at most 2, so r = x - q × m is in [0, 3m).
+
+    if (basic_N_type::detail::opr_comp(x, mod_) < 0) { return; }
+
+    if (x.bits() > 2U * k_) {
+        x = basic_N_type::detail::opr_div(x, mod_).second;
+        return;
+    }
+
+    quotient = x;
+    quotient.opr_bitshift_r_assign_(k_ - 1U);
+    quotient.opr_mult_assign_(mu_);
+    quotient.opr_bitshift_r_assign_(k_ + 1U);
+
+    // q × m <= x, so the fused subtraction never goes negative
+    [[maybe_unused]] const bool negative = x.opr_submul_assign_(quotient, mod_);
+    assert(!negative);
+
+    while (basic_N_type::detail::opr_comp(x, mod_) >= 0) { x.opr_subtr_assign_(mod_); }
+}
+
+}  // namespace jmaths
@@ -92,6 +92,67 @@ constexpr basic_N_type operator|(const basic_N_type & lhs, const basic_N_type &
 template <TMP::instance_of<basic_N> basic_N_type>
 constexpr basic_N_type operator^(const basic_N_type & lhs, const basic_N_type & rhs);
 
+// overloads for expiring operands: the result is computed in the storage of the rvalue operand
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type operator+(basic_N_type && lhs, const basic_N_type & rhs);
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type operator+(const basic_N_type & lhs, basic_N_type && rhs);
+
+template <TMP::instance_of<basic_N> basic_N_type>
+    requires(!std::is_reference_v<basic_N_type>)
+constexpr basic_N_type operator+(basic_N_type && lhs, basic_N_type && rhs);
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type operator-(basic_N_type && lhs, const basic_N_type & rhs);
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type operator-(const basic_N_type & lhs, basic_N_type && rhs);
+
+template <TMP::instance_of<basic_N> basic_N_type>
+    requires(!std::is_reference_v<basic_N_type>)
+constexpr basic_N_type operator-(basic_N_type && lhs, basic_N_type && rhs);
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type operator*(basic_N_type && lhs, const basic_N_type & rhs);
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type operator*(const basic_N_type & lhs, basic_N_type && rhs);
+
+template <TMP::instance_of<basic_N> basic_N_type>
+    requires(!std::is_reference_v<basic_N_type>)
+constexpr basic_N_type operator*(basic_N_type && lhs, basic_N_type && rhs);
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type operator&(basic_N_type && lhs, const basic_N_type & rhs);
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type operator&(const basic_N_type & lhs, basic_N_type && rhs);
+
+template <TMP::instance_of<basic_N> basic_N_type>
+    requires(!std::is_reference_v<basic_N_type>)
+constexpr basic_N_type operator&(basic_N_type && lhs, basic_N_type && rhs);
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type operator|(basic_N_type && lhs, const basic_N_type & rhs);
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type operator|(const basic_N_type & lhs, basic_N_type && rhs);
+
+template <TMP::instance_of<basic_N> basic_N_type>
+    requires(!std::is_reference_v<basic_N_type>)
+constexpr basic_N_type operator|(basic_N_type && lhs, basic_N_type && rhs);
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type operator^(basic_N_type && lhs, const basic_N_type & rhs);
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type operator^(const basic_N_type & lhs, basic_N_type && rhs);
+
+template <TMP::instance_of<basic_N> basic_N_type>
+    requires(!std::is_reference_v<basic_N_type>)
+constexpr basic_N_type operator^(basic_N_type && lhs, basic_N_type && rhs);
+
 template <TMP::instance_of<basic_N> basic_N_type>
 constexpr bool operator==(const basic_N_type & lhs, const basic_N_type & rhs);
 
@@ -126,10 +187,17 @@ constexpr std::strong_ordering operator<=>(std::integral auto lhs, const basic_N
  * EXAMPLE: For base_int_type = uint32_t (radix = 2^32)
  * The number 2^64 + 5 would be stored as: digits_ = {5, 0, 1}
  *
+ * CAPACITY: Storage is never released implicitly. set_zero(), copy assignment, the compound
+ * assignment operators and the fused kernels (addmul etc.) reuse the existing capacity and
+ * only reallocate when it is too small. Move assignment adopts the buffer of the source and
+ * hands the previous buffer of the target back to the source.
+ * A hot loop that repeatedly overwrites the same number therefore stops allocating once
+ * its capacity has grown to the largest intermediate value (see reserve()).
+ *
  * COMPLEXITY SUMMARY:
  * - Addition/Subtraction: O(n)
  * - Multiplication: O(n²) (schoolbook) or O(n^1.585) (Karatsuba, WIP)
- * - Division: O(n×m) bit-by-bit
+ * - Division: O(n×m) digit-wise long division
  * - Comparison: O(1) best case, O(n) worst case
  */
 template <typename BaseInt, typename BaseIntBig, typename Allocator = allocator<BaseInt>>
@@ -157,6 +225,12 @@ class basic_N {
 
     friend struct format_output<basic_N>;
 
+    friend class montgomery_context<basic_N>;
+    friend class barrett_context<basic_N>;
+    friend class crt_basis<basic_N>;
+
+    friend struct expr::evaluator;
+
    public:
     /**
      * @class bit_reference
@@ -179,11 +253,24 @@ class basic_N {
      */
     struct detail;
 
+    /**
+     * @typedef limb_type
+     * @brief Type of a single digit (limb) of the internal representation
+     */
+    using limb_type = base_int_type;
+
     // Compiler-generated special members
     constexpr basic_N(const basic_N &) = default;
     constexpr basic_N(basic_N &&) = default;
     constexpr basic_N & operator=(const basic_N &) = default;
-    constexpr basic_N & operator=(basic_N &&) = default;
+
+    /**
+     * @brief Move assignment
+     * The buffers are exchanged: *this takes the storage of rhs and rhs keeps the previous
+     * storage of *this, so neither buffer is released
+     * POSTCONDITION: rhs.is_zero() == true
+     */
+    constexpr basic_N & operator=(basic_N && rhs) noexcept;
 
     /**
      * @brief Default constructor - creates zero
@@ -258,6 +345,17 @@ class basic_N {
      */
     [[nodiscard]] constexpr bitcount_t bits() const;
 
+    /**
+     * @brief Count the digits of the number in a base without converting it
+     * @param base Numeric base (2-64)
+     * @return to_str(base).size()
+     * @throws error::invalid_base if base out of range
+     * COMPLEXITY: O(1) for powers of 2, O(n) mostly and O(n²) next to a power of the base
+     *
+     * ALGORITHM: floor(log_base(number)) + 1, see ilog_()
+     */
+    [[nodiscard]] constexpr std::size_t digits_in_base(unsigned base = default_base) const;
+
     /**
      * @brief Size of this object in bytes (including dynamic allocation)
      * @return Total memory usage
@@ -327,11 +425,32 @@ class basic_N {
 
     /**
      * @brief Set value to zero
-     * POSTCONDITION: is_zero() == true
+     * POSTCONDITION: is_zero() == true, capacity() is unchanged
      * COMPLEXITY: O(1)
      */
     constexpr void set_zero();
 
+    /**
+     * @brief Preallocate storage for values of up to bits significant bits
+     * @param bits Number of bits to make room for
+     * POSTCONDITION: capacity() >= bits, the value is unchanged
+     * NOTE: Never shrinks the storage
+     */
+    constexpr void reserve(bitcount_t bits);
+
+    /**
+     * @brief Number of bits that can be held without reallocating
+     * @return Allocated storage in bits (a multiple of the digit width)
+     */
+    [[nodiscard]] constexpr bitcount_t capacity() const;
+
+    /**
+     * @brief Release storage not needed by the current value
+     * POSTCONDITION: The value is unchanged; capacity() may be reduced to bits() rounded up
+     * to the digit width (the request is non-binding, as for std::vector)
+     */
+    constexpr void shrink_to_fit();
+
     /**
      * @brief Pre-increment operator
      * @return Reference to *this
@@ -356,6 +475,62 @@ class basic_N {
     constexpr basic_N & operator|=(const basic_N & rhs);
     constexpr basic_N & operator^=(const basic_N & rhs);
 
+    // Fused in-place kernels - grow digits_ in place instead of building temporaries
+
+    /**
+     * @brief Fused multiply-add: *this += a * b
+     * @return Reference to *this
+     * NOTE: a and b may alias *this (a copy is made in that case)
+     * COMPLEXITY: O(n×m), at most one reallocation of digits_
+     */
+    constexpr basic_N & addmul(const basic_N & a, const basic_N & b);
+
+    /**
+     * @brief Fused multiply-add with a single limb: *this += a * b
+     * @return Reference to *this
+     * COMPLEXITY: O(n)
+     */
+    constexpr basic_N & addmul(const basic_N & a, limb_type b);
+
+    /**
+     * @brief Fused multiply-subtract: *this -= a * b
+     * @return Reference to *this
+     * NOTE: Like operator-=, the result is the absolute difference |*this - a * b|
+     * COMPLEXITY: O(n×m)
+     */
+    constexpr basic_N & submul(const basic_N & a, const basic_N & b);
+
+    /**
+     * @brief Fused multiply-subtract with a single limb: *this -= a * b
+     * @return Reference to *this
+     * NOTE: The result is the absolute difference |*this - a * b|
+     * COMPLEXITY: O(n)
+     */
+    constexpr basic_N & submul(const basic_N & a, limb_type b);
+
+    /**
+     * @brief Shifted fused multiply-add: *this += (a * b) << pos
+     * @return Reference to *this
+     * Whole-limb shifts are applied as an offset into digits_; only the remaining
+     * pos % limb bits require shifting a copy of a
+     * COMPLEXITY: O(n×m)
+     */
+    constexpr basic_N & fma_2exp(const basic_N & a, const basic_N & b, bitcount_t pos);
+
+    /**
+     * @brief Multiply by a single limb in place: *this *= b
+     * @return Reference to *this
+     * COMPLEXITY: O(n), no allocation unless the result gains a limb
+     */
+    constexpr basic_N & mul_limb(limb_type b);
+
+    /**
+     * @brief Add a single limb in place: *this += b
+     * @return Reference to *this
+     * COMPLEXITY: O(1) average, O(n) worst case (when carry propagates)
+     */
+    constexpr basic_N & add_limb(limb_type b);
+
     /**
      * @brief Bitwise NOT operator
      * @return New number with all bits flipped
@@ -415,6 +590,36 @@ class basic_N {
     constexpr void opr_or_assign_(const basic_N & rhs);
     constexpr void opr_xor_assign_(const basic_N & rhs);
 
+    /**
+     * @brief Fused multiply-add: *this += (lhs * rhs) << (digit_offset * base_int_type_bits)
+     * @param lhs First factor
+     * @param rhs Second factor
+     * @param digit_offset Number of whole digits the product is shifted left by
+     *
+     * ALGORITHM: Schoolbook multiplication accumulating every partial product row
+     * directly into digits_, so no product temporary is materialised
+     * COMPLEXITY: O(n×m)
+     */
+    constexpr void opr_addmul_assign_(const basic_N & lhs,
+                                      const basic_N & rhs,
+                                      std::size_t digit_offset = 0U);
+
+    /**
+     * @brief Fused multiply-subtract: *this = |*this - (lhs * rhs) << (digit_offset * bits)|
+     * @param lhs First factor
+     * @param rhs Second factor
+     * @param digit_offset Number of whole digits the product is shifted left by
+     * @return true if the shifted product was larger than *this (the result is the magnitude
+     * of a negative difference)
+     *
+     * ALGORITHM: Row-wise multiply with borrow propagation; a final borrow out of the top
+     * digit is resolved with a two's complement negation
+     * COMPLEXITY: O(n×m)
+     */
+    constexpr bool opr_submul_assign_(const basic_N & lhs,
+                                      const basic_N & rhs,
+                                      std::size_t digit_offset = 0U);
+
     [[nodiscard]] constexpr basic_N opr_compl_() const;
     [[nodiscard]] constexpr basic_N opr_bitshift_l_(bitcount_t pos) const;
     [[nodiscard]] constexpr basic_N opr_bitshift_r_(bitcount_t pos) const;
@@ -435,6 +640,18 @@ class basic_N {
      */
     [[nodiscard]] constexpr std::string conv_to_base_(unsigned base = default_base) const;
 
+    /**
+     * @brief Floor of the logarithm to a base
+     * @param base The base (base ≥ 2)
+     * @return floor(log_base(*this))
+     * PRECONDITION: *this is not zero
+     *
+     * ALGORITHM: log₂ of both numbers from their leading 64 bits gives log_base to within
+     * 2^-40. Unless that lies this close to an integer, its floor is the result; otherwise a
+     * single comparison with the power of the base decides.
+     */
+    [[nodiscard]] constexpr bitcount_t ilog_(const basic_N & base) const;
+
    private:
     /**
      * @brief Digit storage - little-endian order
@@ -450,6 +667,36 @@ class basic_N {
      */
     constexpr void remove_leading_zeroes_();
 
+    /**
+     * @brief Add multiplier × lhs into digits_ starting at digit offset
+     * PRECONDITION: digits_.size() >= lhs.digits_.size() + offset
+     * NOTE: A carry out of the top digit appends a new digit
+     */
+    constexpr void addmul_row_(const basic_N & lhs, base_int_type multiplier, std::size_t offset);
+
+    /**
+     * @brief Subtract multiplier × lhs from digits_ starting at digit offset
+     * PRECONDITION: digits_.size() >= lhs.digits_.size() + offset
+     * @return true if a borrow left the top digit (digits_ then holds the difference
+     * modulo radix^digits_.size())
+     */
+    [[nodiscard]] constexpr bool submul_row_(const basic_N & lhs,
+                                             base_int_type multiplier,
+                                             std::size_t offset);
+
+    /**
+     * @brief Two's complement negation of digits_ modulo radix^digits_.size()
+     */
+    constexpr void negate_digits_();
+
+    /**
+     * @brief Divide by a single digit in place
+     * @param divisor Nonzero digit
+     * @return Remainder of the division
+     * COMPLEXITY: O(n), no allocation
+     */
+    constexpr base_int_type div_limb_(base_int_type divisor);
+
     /**
      * @brief Get most significant digit
      * @return First (most significant) digit, or 0 if empty
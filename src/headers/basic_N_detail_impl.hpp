@@ -338,76 +338,119 @@ constexpr auto basic_N<BaseInt, BaseIntBig, Allocator>::detail::opr_div(const ba
     -> std::pair<basic_N, basic_N> {
     JMATHS_FUNCTION_TO_LOG;
 
-    // ALGORITHM: Binary long division (restoring division)
-    // This implements a bit-by-bit division algorithm similar to long division taught in school,
-    // but working in binary. It's called "restoring" because when the remainder becomes negative,
-    // we restore it by adding back the divisor.
+    // ALGORITHM: Schoolbook long division on whole digits (Knuth, TAOCP Vol. 2,
+    // Algorithm D)
     //
     // The algorithm:
-    // 1. Initialize quotient q = 0 and remainder r = 0
-    // 2. For each bit in the dividend (from most significant to least):
-    //    a. Shift remainder left by 1 bit (r = r << 1)
-    //    b. Set the least significant bit of r to the current dividend bit
-    //    c. If r >= divisor:
-    //       - Subtract divisor from r (r = r - divisor)
-    //       - Set the corresponding bit in quotient to 1
-    // 3. Return (quotient, remainder)
+    // 1. Single-digit divisors are handled by one pass of digit-by-digit division
+    // 2. Otherwise normalise: shift both operands left so that the top bit of the
+    //    divisor v is set; this makes the quotient estimates below accurate
+    // 3. For each quotient digit, from most significant to least:
+    //    a. Estimate q̂ from the top two digits of the current remainder u divided by
+    //       the top digit of v, and correct it with the second digit of v; q̂ is then
+    //       at most one too large
+    //    b. Subtract q̂ × v from u at the current digit position
+    //    c. If this went negative, add v back and decrement q̂
+    // 4. The remainder is what is left of u, shifted back right
     //
-    // Time complexity: O(n) where n is the number of bits in the dividend
-    // This is more efficient than repeated subtraction but slower than more advanced
-    // algorithms like Newton-Raphson division for very large numbers.
+    // Time complexity: O(n×m) digit operations for an n-digit dividend and m-digit
+    // divisor, with no temporaries inside the loop
 
     if (lhs.is_zero()) { return {basic_N{}, basic_N{}}; }
 
+    const auto compared = opr_comp(lhs, rhs);
+
     // check if lhs == rhs
-    if (opr_eq(lhs, rhs)) { return {one_, basic_N{}}; }
+    if (compared == 0) { return {one_, basic_N{}}; }
+
+    if (compared < 0) { return {basic_N{}, lhs}; }
 
     std::pair<basic_N, basic_N> result;
 
     auto & [q, r] = result;
 
-    // Pre-allocate memory for quotient to avoid reallocations
-    if (const auto max_size = lhs.digits_.size() - rhs.digits_.size() + 1U;
-        lhs.digits_.size() + 1U >= rhs.digits_.size()) {
-        // rhs.digits_.size() is always >= 1 so even if lhs.digits_.size() + 1
-        // overflows to 0 no errors shall occur
-#ifndef NDEBUG
-        using nlim = std::numeric_limits<decltype(lhs.digits_.size())>;
-#endif
+    if (rhs.digits_.size() == 1U) {
+        q = lhs;
 
-        assert(
-            lhs.digits_.size() == nlim::max() ?
-                !rhs.digits_.empty() :
-            lhs.digits_.size() >= rhs.digits_.size() ?
-                lhs.digits_.size() - rhs.digits_.size() <= nlim::max() - 1U :
-                true /*-(rhs.digits_.size() - lhs.digits_.size()) <= nlim::max() - 1*/);  // assert
-                                                                                          // for
-                                                                                          // overflow
-        assert(lhs.digits_.size() == nlim::max() ?
-                   true :
-                   lhs.digits_.size() + 1U >= rhs.digits_.size());  // assert for overflow to 0
-
-        q.digits_.reserve(max_size);
+        if (const base_int_type remainder = q.div_limb_(rhs.digits_.front()); remainder != 0U) {
+            r.digits_.emplace_back(remainder);
+        }
+
+        return result;
     }
 
-    r.digits_.reserve(rhs.digits_.size());
-
-    // Main division loop: process each bit from most significant to least significant
-    // Calculate the actual number of significant bits in lhs
-    for (bitpos_t i = lhs.digits_.size() * base_int_type_bits -
-                      static_cast<bitcount_t>(std::countl_zero(lhs.digits_.back()));
-         i-- > 0U;) {
-        // Shift remainder left and bring down next bit from dividend
-        r.opr_bitshift_l_assign_(1U);
-        r.bit_(0U, lhs.bit_(i));
-
-        // If remainder >= divisor, subtract and set quotient bit
-        if (opr_comp(r, rhs) >= 0) {
-            r.opr_subtr_assign_(rhs);
-            q.bit_(i, 1);
+    const auto shift = static_cast<bitcount_t>(std::countl_zero(rhs.digits_.back()));
+
+    const basic_N v = rhs.opr_bitshift_l_(shift);
+    basic_N u = lhs.opr_bitshift_l_(shift);
+
+    const std::size_t n = v.digits_.size();
+    const std::size_t m = lhs.digits_.size() - n;
+
+    // u gets one extra digit so that every step can read u[j + n]
+    u.digits_.resize(lhs.digits_.size() + 1U);
+    q.digits_.resize(m + 1U);
+
+    const base_int_big_type v_top = v.digits_[n - 1U];
+    const base_int_big_type v_next = v.digits_[n - 2U];
+
+    for (std::size_t j = m + 1U; j-- > 0U;) {
+        const base_int_big_type numerator =
+            (static_cast<base_int_big_type>(u.digits_[j + n]) << base_int_type_bits) |
+            u.digits_[j + n - 1U];
+
+        base_int_big_type q_hat = numerator / v_top;
+        base_int_big_type r_hat = numerator % v_top;
+
+        // q_hat <= radix + 1 as v is normalised, so these products cannot overflow
+        while (q_hat >= radix ||
+               q_hat * v_next > ((r_hat << base_int_type_bits) | u.digits_[j + n - 2U])) {
+            --q_hat;
+            r_hat += v_top;
+            if (r_hat >= radix) { break; }
         }
+
+        // multiply and subtract, folding each borrow into the next carry
+        base_int_big_type carry = 0U;
+
+        for (std::size_t i = 0U; i < n; ++i) {
+            const base_int_big_type product =
+                static_cast<base_int_big_type>(q_hat * v.digits_[i] + carry);
+            const base_int_type low = static_cast<base_int_type>(product);
+            carry = product >> base_int_type_bits;
+
+            if (u.digits_[i + j] < low) { ++carry; }
+            u.digits_[i + j] -= low;
+        }
+
+        const bool negative = u.digits_[j + n] < carry;
+        u.digits_[j + n] = static_cast<base_int_type>(u.digits_[j + n] - carry);
+
+        if (negative) {
+            // q_hat was one too large: add the divisor back
+            --q_hat;
+            carry = 0U;
+
+            for (std::size_t i = 0U; i < n; ++i) {
+                const base_int_big_type sum = static_cast<base_int_big_type>(
+                    static_cast<base_int_big_type>(u.digits_[i + j]) + v.digits_[i] + carry);
+                u.digits_[i + j] = static_cast<base_int_type>(sum);
+                carry = sum >> base_int_type_bits;
+            }
+
+            u.digits_[j + n] = static_cast<base_int_type>(u.digits_[j + n] + carry);
+        }
+
+        q.digits_[j] = static_cast<base_int_type>(q_hat);
     }
 
+    q.remove_leading_zeroes_();
+
+    u.digits_.resize(n);
+    u.remove_leading_zeroes_();
+    u.opr_bitshift_r_assign_(shift);
+    r = std::move(u);
+
     // Verify the division: quotient * divisor + remainder should equal dividend
     assert(q * rhs + r == lhs);
 
@@ -444,6 +444,160 @@ constexpr std::strong_ordering operator<=>(const basic_N_type & lhs, const basic
     return basic_N_type::detail::opr_comp(lhs, rhs);
 }
 
+/**********************************************************/
+// overloads reusing the storage of expiring operands
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type operator+(basic_N_type && lhs, const basic_N_type & rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs += rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type operator+(const basic_N_type & lhs, basic_N_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    rhs += lhs;
+    return std::move(rhs);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+    requires(!std::is_reference_v<basic_N_type>)
+constexpr basic_N_type operator+(basic_N_type && lhs, basic_N_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs += rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type operator-(basic_N_type && lhs, const basic_N_type & rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs -= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type operator-(const basic_N_type & lhs, basic_N_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // the difference of two N is symmetric
+    rhs -= lhs;
+    return std::move(rhs);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+    requires(!std::is_reference_v<basic_N_type>)
+constexpr basic_N_type operator-(basic_N_type && lhs, basic_N_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs -= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type operator*(basic_N_type && lhs, const basic_N_type & rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs *= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type operator*(const basic_N_type & lhs, basic_N_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    rhs *= lhs;
+    return std::move(rhs);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+    requires(!std::is_reference_v<basic_N_type>)
+constexpr basic_N_type operator*(basic_N_type && lhs, basic_N_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs *= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type operator&(basic_N_type && lhs, const basic_N_type & rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs &= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type operator&(const basic_N_type & lhs, basic_N_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    rhs &= lhs;
+    return std::move(rhs);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+    requires(!std::is_reference_v<basic_N_type>)
+constexpr basic_N_type operator&(basic_N_type && lhs, basic_N_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs &= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type operator|(basic_N_type && lhs, const basic_N_type & rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs |= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type operator|(const basic_N_type & lhs, basic_N_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    rhs |= lhs;
+    return std::move(rhs);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+    requires(!std::is_reference_v<basic_N_type>)
+constexpr basic_N_type operator|(basic_N_type && lhs, basic_N_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs |= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type operator^(basic_N_type && lhs, const basic_N_type & rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs ^= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type operator^(const basic_N_type & lhs, basic_N_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    rhs ^= lhs;
+    return std::move(rhs);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+    requires(!std::is_reference_v<basic_N_type>)
+constexpr basic_N_type operator^(basic_N_type && lhs, basic_N_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs ^= rhs;
+    return std::move(lhs);
+}
+
 }  // namespace jmaths
 
 // member functions of N
@@ -463,25 +617,82 @@ constexpr std::string basic_N<BaseInt, BaseIntBig, Allocator>::conv_to_base_(uns
 
     std::string num_str;
 
-    const std::size_t digits_needed = (digits_.size() * base_int_type_bits) / base + 1U;
+    num_str.reserve(ilog_(basic_N{base}) + 1U);
 
-    num_str.reserve(digits_needed);
+    // the largest power base^chunk_digits that fits into a digit: one pass over helper
+    // then yields chunk_digits characters instead of one
+    base_int_type chunk = static_cast<base_int_type>(base);
+    std::size_t chunk_digits = 1U;
+    while (chunk <= std::numeric_limits<base_int_type>::max() / base) {
+        chunk = static_cast<base_int_type>(chunk * base);
+        ++chunk_digits;
+    }
 
     basic_N helper(*this);
 
+    // dividing in place reuses the storage of helper for every quotient; the reserved
+    // string is returned as is, as shrinking it would only cost another allocation
     while (!helper.is_zero()) {
-        auto [quotient, remainder] = detail::opr_div(helper, base);
-        num_str.push_back(base_converter[remainder.front_()]);
-        helper = std::move(quotient);
+        base_int_type remainder = helper.div_limb_(chunk);
+        // the last chunk is not padded with leading zeroes
+        for (std::size_t i = 0U; i < chunk_digits && (remainder != 0U || !helper.is_zero());
+             ++i) {
+            num_str.push_back(base_converter[remainder % base]);
+            remainder = static_cast<base_int_type>(remainder / base);
+        }
     }
 
-    num_str.shrink_to_fit();
-
     std::ranges::reverse(num_str);
 
     return num_str;
 }
 
+template <typename BaseInt, typename BaseIntBig, typename Allocator>
+constexpr bitcount_t basic_N<BaseInt, BaseIntBig, Allocator>::ilog_(const basic_N & base) const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    assert(!is_zero());
+    assert(!base.is_zero() && !base.is_one());
+
+    if (detail::opr_comp(*this, base) < 0) { return 0U; }
+
+    if consteval {
+        // no floating point, count the powers of the base instead
+        bitcount_t k = 0U;
+        basic_N power = base;
+        while (detail::opr_comp(power, *this) <= 0) {
+            power.opr_mult_assign_(base);
+            ++k;
+        }
+        return k;
+    }
+
+    // log2 from the leading 64 bits, the lower bits only shift it
+    const auto log2 = [](const basic_N & num) {
+        const bitcount_t bits = num.bits();
+        const bitcount_t shift = bits > 64U ? bits - 64U : 0U;
+        const auto top = *num.opr_bitshift_r_(shift).template fits_into<std::uint64_t>();
+        return static_cast<double>(shift) + std::log2(static_cast<double>(top));
+    };
+
+    // both logarithms are exact to about 2^-50 relative to their size
+    const double estimate = log2(*this) / log2(base);
+    const double tolerance = std::ldexp(estimate + 1.0, -40);
+    const auto lower = static_cast<bitcount_t>(estimate - tolerance);
+    const auto upper = static_cast<bitcount_t>(estimate + tolerance);
+
+    if (lower == upper) { return lower; }
+
+    // close to base^upper: compare with it
+    basic_N power = one_;
+    for (auto i = static_cast<bitcount_t>(std::bit_width(upper)); i-- > 0U;) {
+        power.opr_mult_assign_(power);
+        if ((upper >> i & 1U) != 0U) { power.opr_mult_assign_(base); }
+    }
+
+    return detail::opr_comp(power, *this) <= 0 ? upper : lower;
+}
+
 template <typename BaseInt, typename BaseIntBig, typename Allocator>
 constexpr void basic_N<BaseInt, BaseIntBig, Allocator>::remove_leading_zeroes_() {
     JMATHS_FUNCTION_TO_LOG;
@@ -494,6 +705,102 @@ constexpr void basic_N<BaseInt, BaseIntBig, Allocator>::remove_leading_zeroes_()
     assert(digits_.empty() || digits_.back() != 0U);
 }
 
+template <typename BaseInt, typename BaseIntBig, typename Allocator>
+constexpr void basic_N<BaseInt, BaseIntBig, Allocator>::addmul_row_(const basic_N & lhs,
+                                                                    base_int_type multiplier,
+                                                                    std::size_t offset) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    base_int_big_type carry = 0U;
+    std::size_t k = offset;
+
+    // (radix - 1)² + 2 × (radix - 1) == radix² - 1, so this never overflows
+    for (std::size_t j = 0U; j < lhs.digits_.size(); ++j, ++k) {
+        const base_int_big_type temp = static_cast<base_int_big_type>(
+            static_cast<base_int_big_type>(multiplier) * lhs.digits_[j] + digits_[k] + carry);
+        digits_[k] = static_cast<base_int_type>(temp);
+        carry = temp >> base_int_type_bits;
+    }
+
+    for (; carry != 0U; ++k) {
+        if (k == digits_.size()) {
+            digits_.emplace_back(static_cast<base_int_type>(carry));
+            return;
+        }
+
+        const base_int_big_type temp = static_cast<base_int_big_type>(digits_[k] + carry);
+        digits_[k] = static_cast<base_int_type>(temp);
+        carry = temp >> base_int_type_bits;
+    }
+}
+
+template <typename BaseInt, typename BaseIntBig, typename Allocator>
+constexpr bool basic_N<BaseInt, BaseIntBig, Allocator>::submul_row_(const basic_N & lhs,
+                                                                    base_int_type multiplier,
+                                                                    std::size_t offset) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    base_int_big_type carry = 0U;
+    std::size_t k = offset;
+
+    for (std::size_t j = 0U; j < lhs.digits_.size(); ++j, ++k) {
+        const base_int_big_type temp = static_cast<base_int_big_type>(
+            static_cast<base_int_big_type>(multiplier) * lhs.digits_[j] + carry);
+        const base_int_type low = static_cast<base_int_type>(temp);
+        carry = temp >> base_int_type_bits;
+
+        // the borrow is folded into the amount subtracted from the next digit
+        if (digits_[k] < low) { ++carry; }
+        digits_[k] -= low;
+    }
+
+    for (; carry != 0U; ++k) {
+        if (k == digits_.size()) { return true; }
+
+        const base_int_type low = static_cast<base_int_type>(carry);
+        carry >>= base_int_type_bits;
+
+        if (digits_[k] < low) { ++carry; }
+        digits_[k] -= low;
+    }
+
+    return false;
+}
+
+template <typename BaseInt, typename BaseIntBig, typename Allocator>
+constexpr auto basic_N<BaseInt, BaseIntBig, Allocator>::div_limb_(base_int_type divisor)
+    -> base_int_type {
+    JMATHS_FUNCTION_TO_LOG;
+
+    assert(divisor != 0U);
+
+    base_int_big_type remainder = 0U;
+
+    for (std::size_t i = digits_.size(); i-- > 0U;) {
+        const base_int_big_type current = (remainder << base_int_type_bits) | digits_[i];
+        digits_[i] = static_cast<base_int_type>(current / divisor);
+        remainder = current % divisor;
+    }
+
+    remove_leading_zeroes_();
+
+    return static_cast<base_int_type>(remainder);
+}
+
+template <typename BaseInt, typename BaseIntBig, typename Allocator>
+constexpr void basic_N<BaseInt, BaseIntBig, Allocator>::negate_digits_() {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // two's complement negation turns radix^n - x back into x
+    for (auto & digit : digits_) {
+        digit = static_cast<base_int_type>(~digit);
+    }
+
+    for (auto & digit : digits_) {
+        if (++digit != 0U) { break; }
+    }
+}
+
 template <typename BaseInt, typename BaseIntBig, typename Allocator>
 constexpr auto basic_N<BaseInt, BaseIntBig, Allocator>::front_() const -> base_int_type {
     JMATHS_FUNCTION_TO_LOG;
@@ -670,8 +977,6 @@ template <typename BaseInt, typename BaseIntBig, typename Allocator>
 constexpr void basic_N<BaseInt, BaseIntBig, Allocator>::opr_mult_assign_(const basic_N & rhs) {
     JMATHS_FUNCTION_TO_LOG;
 
-    // !!! remove temporary (at least temp1) !!!
-
     // check for multiplicative identity
     if (this->is_one()) {
         operator=(rhs);
@@ -688,32 +993,93 @@ constexpr void basic_N<BaseInt, BaseIntBig, Allocator>::opr_mult_assign_(const b
         return;
     }
 
-    basic_N product;
+    // the rows below overwrite digits_, so rhs must not share them
+    if (this == &rhs) {
+        const basic_N copy = rhs;
+        opr_mult_assign_(copy);
+        return;
+    }
+
+    const std::size_t size = digits_.size();
+
+    // the product is computed in place: only reallocates if the capacity is too small
+    digits_.resize(size + rhs.digits_.size());
+
+    // going from the most significant digit down, row i only writes to digits at
+    // positions >= i, all of which have already been consumed
+    for (std::size_t i = size; i-- > 0U;) {
+        const base_int_type multiplier = digits_[i];
+        digits_[i] = 0U;
+
+        if (multiplier != 0U) { addmul_row_(rhs, multiplier, i); }
+    }
+
+    remove_leading_zeroes_();
+}
+
+template <typename BaseInt, typename BaseIntBig, typename Allocator>
+constexpr void basic_N<BaseInt, BaseIntBig, Allocator>::opr_addmul_assign_(
+    const basic_N & lhs,
+    const basic_N & rhs,
+    std::size_t digit_offset) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    if (lhs.is_zero() || rhs.is_zero()) { return; }
+
+    // the rows are accumulated into digits_, so a factor must not share them
+    if (this == &lhs || this == &rhs) {
+        const basic_N copy = *this;
+        opr_addmul_assign_(this == &lhs ? copy : lhs, this == &rhs ? copy : rhs, digit_offset);
+        return;
+    }
+
+    const std::size_t product_size = lhs.digits_.size() + rhs.digits_.size() + digit_offset;
 
-    // max storage surplus would be base_int_size
-    product.digits_.reserve(this->digits_.size() + rhs.digits_.size());
+    digits_.reserve(std::max(digits_.size(), product_size) + 1U);
+    if (digits_.size() < product_size) { digits_.resize(product_size); }
 
     for (std::size_t i = 0U; i < rhs.digits_.size(); ++i) {
-        basic_N temp1;
-        temp1.digits_.reserve(i + this->digits_.size() + 1U);
-        temp1.digits_.insert(temp1.digits_.begin(), i, 0U);
-        base_int_type carry = 0U;
-        for (std::size_t j = 0U; j < this->digits_.size(); ++j) {
-            const base_int_big_type temp2 = static_cast<base_int_big_type>(rhs.digits_[i]) *
-                                            static_cast<base_int_big_type>(this->digits_[j]);
-            const base_int_type temp3 = static_cast<base_int_type>(temp2);
-            temp1.digits_.emplace_back(carry + temp3);
-            const base_int_type temp_carry = static_cast<base_int_type>(
-                (static_cast<base_int_big_type>(carry) + static_cast<base_int_big_type>(temp3)) >>
-                base_int_type_bits);
-            carry = static_cast<base_int_type>((temp2 >> base_int_type_bits) + temp_carry);
-        }
+        if (rhs.digits_[i] != 0U) { addmul_row_(lhs, rhs.digits_[i], i + digit_offset); }
+    }
 
-        if (carry != 0U) { temp1.digits_.emplace_back(carry); }
-        product.opr_add_assign_(temp1);
+    remove_leading_zeroes_();
+}
+
+template <typename BaseInt, typename BaseIntBig, typename Allocator>
+constexpr bool basic_N<BaseInt, BaseIntBig, Allocator>::opr_submul_assign_(
+    const basic_N & lhs,
+    const basic_N & rhs,
+    std::size_t digit_offset) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    if (lhs.is_zero() || rhs.is_zero()) { return false; }
+
+    if (this == &lhs || this == &rhs) {
+        const basic_N copy = *this;
+        return opr_submul_assign_(this == &lhs ? copy : lhs,
+                                  this == &rhs ? copy : rhs,
+                                  digit_offset);
+    }
+
+    const std::size_t product_size = lhs.digits_.size() + rhs.digits_.size() + digit_offset;
+
+    if (digits_.size() < product_size) { digits_.resize(product_size); }
+
+    // digits_ holds the difference modulo radix^digits_.size(); since the product is
+    // smaller than that power the difference can wrap around at most once
+    bool borrow_out = false;
+
+    for (std::size_t i = 0U; i < rhs.digits_.size(); ++i) {
+        if (rhs.digits_[i] != 0U && submul_row_(lhs, rhs.digits_[i], i + digit_offset)) {
+            borrow_out = true;
+        }
     }
 
-    operator=(std::move(product));
+    if (borrow_out) { negate_digits_(); }
+
+    remove_leading_zeroes_();
+
+    return borrow_out;
 }
 
 template <typename BaseInt, typename BaseIntBig, typename Allocator>
@@ -1038,6 +1404,23 @@ constexpr bitcount_t basic_N<BaseInt, BaseIntBig, Allocator>::bits() const {
            static_cast<bitcount_t>(std::countl_zero(digits_.back()));
 }
 
+template <typename BaseInt, typename BaseIntBig, typename Allocator>
+constexpr std::size_t basic_N<BaseInt, BaseIntBig, Allocator>::digits_in_base(unsigned base) const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    error::invalid_base::check(base);
+
+    if (is_zero()) { return 1U; }
+
+    // a digit of base 2^w holds exactly w bits
+    if (std::has_single_bit(base)) {
+        const auto width = static_cast<bitcount_t>(std::countr_zero(base));
+        return (bits() + width - 1U) / width;
+    }
+
+    return ilog_(basic_N{base}) + 1U;
+}
+
 template <typename BaseInt, typename BaseIntBig, typename Allocator>
 constexpr std::size_t basic_N<BaseInt, BaseIntBig, Allocator>::size() const {
     JMATHS_FUNCTION_TO_LOG;
@@ -1135,6 +1518,19 @@ constexpr auto basic_N<BaseInt, BaseIntBig, Allocator>::operator[](
     return {*this, pos};
 }
 
+template <typename BaseInt, typename BaseIntBig, typename Allocator>
+constexpr auto basic_N<BaseInt, BaseIntBig, Allocator>::operator=(basic_N && rhs) noexcept
+    -> basic_N & {
+    JMATHS_FUNCTION_TO_LOG;
+
+    if (this != &rhs) {
+        digits_.swap(rhs.digits_);
+        rhs.digits_.clear();
+    }
+
+    return *this;
+}
+
 template <typename BaseInt, typename BaseIntBig, typename Allocator>
 constexpr void basic_N<BaseInt, BaseIntBig, Allocator>::set_zero() {
     JMATHS_FUNCTION_TO_LOG;
@@ -1142,6 +1538,27 @@ constexpr void basic_N<BaseInt, BaseIntBig, Allocator>::set_zero() {
     digits_.clear();
 }
 
+template <typename BaseInt, typename BaseIntBig, typename Allocator>
+constexpr void basic_N<BaseInt, BaseIntBig, Allocator>::reserve(bitcount_t bits) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    digits_.reserve(static_cast<std::size_t>((bits + base_int_type_bits - 1U) / base_int_type_bits));
+}
+
+template <typename BaseInt, typename BaseIntBig, typename Allocator>
+constexpr bitcount_t basic_N<BaseInt, BaseIntBig, Allocator>::capacity() const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    return digits_.capacity() * base_int_type_bits;
+}
+
+template <typename BaseInt, typename BaseIntBig, typename Allocator>
+constexpr void basic_N<BaseInt, BaseIntBig, Allocator>::shrink_to_fit() {
+    JMATHS_FUNCTION_TO_LOG;
+
+    digits_.shrink_to_fit();
+}
+
 template <typename BaseInt, typename BaseIntBig, typename Allocator>
 constexpr auto basic_N<BaseInt, BaseIntBig, Allocator>::operator++() -> basic_N & {
     JMATHS_FUNCTION_TO_LOG;
@@ -1219,6 +1636,123 @@ constexpr auto basic_N<BaseInt, BaseIntBig, Allocator>::operator^=(const basic_N
     return *this;
 }
 
+template <typename BaseInt, typename BaseIntBig, typename Allocator>
+constexpr auto basic_N<BaseInt, BaseIntBig, Allocator>::addmul(const basic_N & a,
+                                                                const basic_N & b) -> basic_N & {
+    JMATHS_FUNCTION_TO_LOG;
+
+    opr_addmul_assign_(a, b);
+    return *this;
+}
+
+template <typename BaseInt, typename BaseIntBig, typename Allocator>
+constexpr auto basic_N<BaseInt, BaseIntBig, Allocator>::addmul(const basic_N & a, limb_type b)
+    -> basic_N & {
+    JMATHS_FUNCTION_TO_LOG;
+
+    if (a.is_zero() || b == 0U) { return *this; }
+
+    // a single row reads every digit of a before writing the same position, so a may
+    // alias *this
+    digits_.reserve(std::max(digits_.size(), a.digits_.size()) + 1U);
+    if (digits_.size() < a.digits_.size()) { digits_.resize(a.digits_.size()); }
+
+    addmul_row_(a, b, 0U);
+
+    return *this;
+}
+
+template <typename BaseInt, typename BaseIntBig, typename Allocator>
+constexpr auto basic_N<BaseInt, BaseIntBig, Allocator>::submul(const basic_N & a,
+                                                                const basic_N & b) -> basic_N & {
+    JMATHS_FUNCTION_TO_LOG;
+
+    opr_submul_assign_(a, b);
+    return *this;
+}
+
+template <typename BaseInt, typename BaseIntBig, typename Allocator>
+constexpr auto basic_N<BaseInt, BaseIntBig, Allocator>::submul(const basic_N & a, limb_type b)
+    -> basic_N & {
+    JMATHS_FUNCTION_TO_LOG;
+
+    if (a.is_zero() || b == 0U) { return *this; }
+
+    // the product a * b has at most one digit more than a
+    if (digits_.size() < a.digits_.size() + 1U) { digits_.resize(a.digits_.size() + 1U); }
+
+    if (submul_row_(a, b, 0U)) { negate_digits_(); }
+
+    remove_leading_zeroes_();
+
+    return *this;
+}
+
+template <typename BaseInt, typename BaseIntBig, typename Allocator>
+constexpr auto basic_N<BaseInt, BaseIntBig, Allocator>::fma_2exp(const basic_N & a,
+                                                                  const basic_N & b,
+                                                                  bitcount_t pos) -> basic_N & {
+    JMATHS_FUNCTION_TO_LOG;
+
+    const std::size_t digit_offset = pos / base_int_type_bits;
+
+    if (const bitcount_t residual = pos % base_int_type_bits; residual != 0U) {
+        opr_addmul_assign_(a.opr_bitshift_l_(residual), b, digit_offset);
+    } else {
+        opr_addmul_assign_(a, b, digit_offset);
+    }
+
+    return *this;
+}
+
+template <typename BaseInt, typename BaseIntBig, typename Allocator>
+constexpr auto basic_N<BaseInt, BaseIntBig, Allocator>::mul_limb(limb_type b) -> basic_N & {
+    JMATHS_FUNCTION_TO_LOG;
+
+    if (b == 0U) {
+        set_zero();
+        return *this;
+    }
+
+    base_int_big_type carry = 0U;
+
+    for (auto & digit : digits_) {
+        const base_int_big_type temp = static_cast<base_int_big_type>(
+            static_cast<base_int_big_type>(b) * digit + carry);
+        digit = static_cast<base_int_type>(temp);
+        carry = temp >> base_int_type_bits;
+    }
+
+    if (carry != 0U) { digits_.emplace_back(static_cast<base_int_type>(carry)); }
+
+    return *this;
+}
+
+template <typename BaseInt, typename BaseIntBig, typename Allocator>
+constexpr auto basic_N<BaseInt, BaseIntBig, Allocator>::add_limb(limb_type b) -> basic_N & {
+    JMATHS_FUNCTION_TO_LOG;
+
+    if (b == 0U) { return *this; }
+
+    if (is_zero()) {
+        digits_.emplace_back(b);
+        return *this;
+    }
+
+    const bool carry = digits_.front() > max_digit - b;
+    digits_.front() += b;
+
+    if (!carry) { return *this; }
+
+    for (std::size_t i = 1U; i < digits_.size(); ++i) {
+        if (digits_[i]++ < max_digit) { return *this; }
+    }
+
+    digits_.emplace_back(1);
+
+    return *this;
+}
+
 template <typename BaseInt, typename BaseIntBig, typename Allocator>
 constexpr auto basic_N<BaseInt, BaseIntBig, Allocator>::operator~() const -> basic_N {
     JMATHS_FUNCTION_TO_LOG;
@@ -27,6 +27,7 @@
 #include <ostream>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <tuple>
 
 #include "TMP.hpp"
@@ -91,6 +92,70 @@ constexpr basic_Q_type operator|(const basic_Q_type & lhs, const basic_Q_type &
 template <TMP::instance_of<basic_Q> basic_Q_type>
 constexpr basic_Q_type operator^(const basic_Q_type & lhs, const basic_Q_type & rhs);
 
+// overloads for expiring operands: the result is computed in the storage of the rvalue operand
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator+(basic_Q_type && lhs, const basic_Q_type & rhs);
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator+(const basic_Q_type & lhs, basic_Q_type && rhs);
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+    requires(!std::is_reference_v<basic_Q_type>)
+constexpr basic_Q_type operator+(basic_Q_type && lhs, basic_Q_type && rhs);
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator-(basic_Q_type && lhs, const basic_Q_type & rhs);
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator-(const basic_Q_type & lhs, basic_Q_type && rhs);
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+    requires(!std::is_reference_v<basic_Q_type>)
+constexpr basic_Q_type operator-(basic_Q_type && lhs, basic_Q_type && rhs);
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator*(basic_Q_type && lhs, const basic_Q_type & rhs);
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator*(const basic_Q_type & lhs, basic_Q_type && rhs);
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+    requires(!std::is_reference_v<basic_Q_type>)
+constexpr basic_Q_type operator*(basic_Q_type && lhs, basic_Q_type && rhs);
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator/(basic_Q_type && lhs, const basic_Q_type & rhs);
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator&(basic_Q_type && lhs, const basic_Q_type & rhs);
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator&(const basic_Q_type & lhs, basic_Q_type && rhs);
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+    requires(!std::is_reference_v<basic_Q_type>)
+constexpr basic_Q_type operator&(basic_Q_type && lhs, basic_Q_type && rhs);
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator|(basic_Q_type && lhs, const basic_Q_type & rhs);
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator|(const basic_Q_type & lhs, basic_Q_type && rhs);
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+    requires(!std::is_reference_v<basic_Q_type>)
+constexpr basic_Q_type operator|(basic_Q_type && lhs, basic_Q_type && rhs);
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator^(basic_Q_type && lhs, const basic_Q_type & rhs);
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator^(const basic_Q_type & lhs, basic_Q_type && rhs);
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+    requires(!std::is_reference_v<basic_Q_type>)
+constexpr basic_Q_type operator^(basic_Q_type && lhs, basic_Q_type && rhs);
+
 template <TMP::instance_of<basic_Q> basic_Q_type>
 constexpr bool operator==(const basic_Q_type & lhs, const basic_Q_type & rhs);
 
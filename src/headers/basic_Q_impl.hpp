@@ -531,6 +531,168 @@ constexpr std::strong_ordering operator<=>(const basic_Q_type & lhs, const basic
     return basic_Q_type::detail::opr_comp(lhs, rhs);
 }
 
+/**********************************************************/
+// overloads reusing the storage of expiring operands
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator+(basic_Q_type && lhs, const basic_Q_type & rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs += rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator+(const basic_Q_type & lhs, basic_Q_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    rhs += lhs;
+    return std::move(rhs);
+}
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+    requires(!std::is_reference_v<basic_Q_type>)
+constexpr basic_Q_type operator+(basic_Q_type && lhs, basic_Q_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs += rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator-(basic_Q_type && lhs, const basic_Q_type & rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs -= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator-(const basic_Q_type & lhs, basic_Q_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // lhs - rhs == -(rhs - lhs)
+    rhs -= lhs;
+    return -std::move(rhs);
+}
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+    requires(!std::is_reference_v<basic_Q_type>)
+constexpr basic_Q_type operator-(basic_Q_type && lhs, basic_Q_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs -= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator*(basic_Q_type && lhs, const basic_Q_type & rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs *= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator*(const basic_Q_type & lhs, basic_Q_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    rhs *= lhs;
+    return std::move(rhs);
+}
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+    requires(!std::is_reference_v<basic_Q_type>)
+constexpr basic_Q_type operator*(basic_Q_type && lhs, basic_Q_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs *= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator/(basic_Q_type && lhs, const basic_Q_type & rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs /= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator&(basic_Q_type && lhs, const basic_Q_type & rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs &= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator&(const basic_Q_type & lhs, basic_Q_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    rhs &= lhs;
+    return std::move(rhs);
+}
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+    requires(!std::is_reference_v<basic_Q_type>)
+constexpr basic_Q_type operator&(basic_Q_type && lhs, basic_Q_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs &= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator|(basic_Q_type && lhs, const basic_Q_type & rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs |= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator|(const basic_Q_type & lhs, basic_Q_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    rhs |= lhs;
+    return std::move(rhs);
+}
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+    requires(!std::is_reference_v<basic_Q_type>)
+constexpr basic_Q_type operator|(basic_Q_type && lhs, basic_Q_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs |= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator^(basic_Q_type && lhs, const basic_Q_type & rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs ^= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+constexpr basic_Q_type operator^(const basic_Q_type & lhs, basic_Q_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    rhs ^= lhs;
+    return std::move(rhs);
+}
+
+template <TMP::instance_of<basic_Q> basic_Q_type>
+    requires(!std::is_reference_v<basic_Q_type>)
+constexpr basic_Q_type operator^(basic_Q_type && lhs, basic_Q_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs ^= rhs;
+    return std::move(lhs);
+}
+
 }  // namespace jmaths
 
 // member functions of Q
@@ -1277,6 +1439,11 @@ constexpr auto basic_Q<BaseInt, BaseIntBig, Allocator>::operator-=(const basic_Q
         if (rhs.is_positive()) {
             // Case 3: negative - positive = -(|lhs| + |rhs|)
             basic_N_type first_product = basic_N_type::detail::opr_mult(num_, rhs.denom_);
+            first_product.opr_add_assign_(basic_N_type::detail::opr_mult(denom_, rhs.num_));
+            num_ = std::move(first_product);
+        } else {
+            // Case 4: negative - negative = -(|lhs| - |rhs|)
+            basic_N_type first_product = basic_N_type::detail::opr_mult(num_, rhs.denom_);
             basic_N_type second_product = basic_N_type::detail::opr_mult(denom_, rhs.num_);
 
             if (const auto difference =
@@ -1285,19 +1452,15 @@ constexpr auto basic_Q<BaseInt, BaseIntBig, Allocator>::operator-=(const basic_Q
                 num_.set_zero();
                 denom_ = basic_N_type::one_;
                 set_sign_(positive);
+                return *this;
             } else if (difference > 0) {
-                first_product.opr_add_assign_(second_product);
+                first_product.opr_subtr_assign_(second_product);
                 num_ = std::move(first_product);
             } else {
-                second_product.opr_add_assign_(first_product);
+                second_product.opr_subtr_assign_(first_product);
                 num_ = std::move(second_product);
                 set_sign_(positive);
             }
-        } else {
-            // Case 4: negative - negative
-            basic_N_type first_product = basic_N_type::detail::opr_mult(num_, rhs.denom_);
-            first_product.opr_subtr_assign_(basic_N_type::detail::opr_mult(denom_, rhs.num_));
-            num_ = std::move(first_product);
         }
     }
 
@@ -1465,6 +1628,7 @@ template <typename BaseInt, typename BaseIntBig, typename Allocator>
 constexpr auto basic_Q<BaseInt, BaseIntBig, Allocator>::operator-() && -> basic_Q && {
     JMATHS_FUNCTION_TO_LOG;
 
+    if (is_zero()) { return std::move(*this); }
     flip_sign();
     return std::move(*this);
 }
@@ -27,6 +27,7 @@
 #include <ostream>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 
 #include "TMP.hpp"
@@ -92,6 +93,67 @@ constexpr basic_Z_type operator|(const basic_Z_type & lhs, const basic_Z_type &
 template <TMP::instance_of<basic_Z> basic_Z_type>
 constexpr basic_Z_type operator^(const basic_Z_type & lhs, const basic_Z_type & rhs);
 
+// overloads for expiring operands: the result is computed in the storage of the rvalue operand
+template <TMP::instance_of<basic_Z> basic_Z_type>
+constexpr basic_Z_type operator+(basic_Z_type && lhs, const basic_Z_type & rhs);
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+constexpr basic_Z_type operator+(const basic_Z_type & lhs, basic_Z_type && rhs);
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+    requires(!std::is_reference_v<basic_Z_type>)
+constexpr basic_Z_type operator+(basic_Z_type && lhs, basic_Z_type && rhs);
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+constexpr basic_Z_type operator-(basic_Z_type && lhs, const basic_Z_type & rhs);
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+constexpr basic_Z_type operator-(const basic_Z_type & lhs, basic_Z_type && rhs);
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+    requires(!std::is_reference_v<basic_Z_type>)
+constexpr basic_Z_type operator-(basic_Z_type && lhs, basic_Z_type && rhs);
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+constexpr basic_Z_type operator*(basic_Z_type && lhs, const basic_Z_type & rhs);
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+constexpr basic_Z_type operator*(const basic_Z_type & lhs, basic_Z_type && rhs);
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+    requires(!std::is_reference_v<basic_Z_type>)
+constexpr basic_Z_type operator*(basic_Z_type && lhs, basic_Z_type && rhs);
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+constexpr basic_Z_type operator&(basic_Z_type && lhs, const basic_Z_type & rhs);
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+constexpr basic_Z_type operator&(const basic_Z_type & lhs, basic_Z_type && rhs);
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+    requires(!std::is_reference_v<basic_Z_type>)
+constexpr basic_Z_type operator&(basic_Z_type && lhs, basic_Z_type && rhs);
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+constexpr basic_Z_type operator|(basic_Z_type && lhs, const basic_Z_type & rhs);
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+constexpr basic_Z_type operator|(const basic_Z_type & lhs, basic_Z_type && rhs);
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+    requires(!std::is_reference_v<basic_Z_type>)
+constexpr basic_Z_type operator|(basic_Z_type && lhs, basic_Z_type && rhs);
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+constexpr basic_Z_type operator^(basic_Z_type && lhs, const basic_Z_type & rhs);
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+constexpr basic_Z_type operator^(const basic_Z_type & lhs, basic_Z_type && rhs);
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+    requires(!std::is_reference_v<basic_Z_type>)
+constexpr basic_Z_type operator^(basic_Z_type && lhs, basic_Z_type && rhs);
+
 template <TMP::instance_of<basic_Z> basic_Z_type>
 constexpr bool operator==(const basic_Z_type & lhs, const basic_Z_type & rhs);
 
@@ -157,10 +219,13 @@ class basic_Z final : public sign_type, private basic_N<BaseInt, BaseIntBig, All
 
     friend struct format_output<basic_Z>;
 
+    friend struct expr::evaluator;
+
    public:
     using basic_N_type::ctz, basic_N_type::bits, basic_N_type::operator bool,
         basic_N_type::operator[];
     using basic_N_type::is_even, basic_N_type::is_odd;
+    using basic_N_type::reserve, basic_N_type::capacity, basic_N_type::shrink_to_fit;
     using typename basic_N_type::bit_reference, typename basic_N_type::const_bit_reference;
 
     struct detail;
@@ -208,6 +273,13 @@ class basic_Z final : public sign_type, private basic_N<BaseInt, BaseIntBig, All
     constexpr basic_Z & operator|=(const basic_Z & rhs);
     constexpr basic_Z & operator^=(const basic_Z & rhs);
 
+    // fused in-place kernels, see basic_N::addmul
+    constexpr basic_Z & addmul(const basic_Z & a, const basic_Z & b);  // *this += a * b
+    constexpr basic_Z & submul(const basic_Z & a, const basic_Z & b);  // *this -= a * b
+    constexpr basic_Z & fma_2exp(const basic_Z & a,
+                                 const basic_Z & b,
+                                 bitcount_t pos);  // *this += (a * b) << pos
+
     [[nodiscard]] constexpr basic_Z operator-() const &;
     [[nodiscard]] constexpr basic_Z && operator-() &&;
     [[nodiscard]] constexpr basic_Z operator~() const;
@@ -227,6 +299,12 @@ class basic_Z final : public sign_type, private basic_N<BaseInt, BaseIntBig, All
     constexpr basic_Z(basic_N_type && n, sign_bool sign);
     constexpr basic_Z(const basic_N_type & n, sign_bool sign);
 
+    // *this ± (lhs * rhs) << (digit_offset * base_int_type_bits), see basic_N::opr_addmul_assign_
+    constexpr void opr_addmul_assign_(const basic_Z & lhs,
+                                      const basic_Z & rhs,
+                                      bool subtract,
+                                      std::size_t digit_offset = 0U);
+
     [[nodiscard]] constexpr std::string conv_to_base_(unsigned base = default_base) const;
 
     [[nodiscard]] constexpr std::size_t dynamic_size_() const;
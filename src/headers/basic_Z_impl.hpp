@@ -311,6 +311,160 @@ constexpr std::strong_ordering operator<=>(const basic_Z_type & lhs, const basic
     return basic_Z_type::detail::opr_comp(lhs, rhs);
 }
 
+/**********************************************************/
+// overloads reusing the storage of expiring operands
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+constexpr basic_Z_type operator+(basic_Z_type && lhs, const basic_Z_type & rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs += rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+constexpr basic_Z_type operator+(const basic_Z_type & lhs, basic_Z_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    rhs += lhs;
+    return std::move(rhs);
+}
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+    requires(!std::is_reference_v<basic_Z_type>)
+constexpr basic_Z_type operator+(basic_Z_type && lhs, basic_Z_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs += rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+constexpr basic_Z_type operator-(basic_Z_type && lhs, const basic_Z_type & rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs -= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+constexpr basic_Z_type operator-(const basic_Z_type & lhs, basic_Z_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // lhs - rhs == -(rhs - lhs)
+    rhs -= lhs;
+    return -std::move(rhs);
+}
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+    requires(!std::is_reference_v<basic_Z_type>)
+constexpr basic_Z_type operator-(basic_Z_type && lhs, basic_Z_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs -= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+constexpr basic_Z_type operator*(basic_Z_type && lhs, const basic_Z_type & rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs *= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+constexpr basic_Z_type operator*(const basic_Z_type & lhs, basic_Z_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    rhs *= lhs;
+    return std::move(rhs);
+}
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+    requires(!std::is_reference_v<basic_Z_type>)
+constexpr basic_Z_type operator*(basic_Z_type && lhs, basic_Z_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs *= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+constexpr basic_Z_type operator&(basic_Z_type && lhs, const basic_Z_type & rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs &= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+constexpr basic_Z_type operator&(const basic_Z_type & lhs, basic_Z_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    rhs &= lhs;
+    return std::move(rhs);
+}
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+    requires(!std::is_reference_v<basic_Z_type>)
+constexpr basic_Z_type operator&(basic_Z_type && lhs, basic_Z_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs &= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+constexpr basic_Z_type operator|(basic_Z_type && lhs, const basic_Z_type & rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs |= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+constexpr basic_Z_type operator|(const basic_Z_type & lhs, basic_Z_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    rhs |= lhs;
+    return std::move(rhs);
+}
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+    requires(!std::is_reference_v<basic_Z_type>)
+constexpr basic_Z_type operator|(basic_Z_type && lhs, basic_Z_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs |= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+constexpr basic_Z_type operator^(basic_Z_type && lhs, const basic_Z_type & rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs ^= rhs;
+    return std::move(lhs);
+}
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+constexpr basic_Z_type operator^(const basic_Z_type & lhs, basic_Z_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    rhs ^= lhs;
+    return std::move(rhs);
+}
+
+template <TMP::instance_of<basic_Z> basic_Z_type>
+    requires(!std::is_reference_v<basic_Z_type>)
+constexpr basic_Z_type operator^(basic_Z_type && lhs, basic_Z_type && rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    lhs ^= rhs;
+    return std::move(lhs);
+}
+
 }  // namespace jmaths
 
 // member functions of Z
@@ -338,6 +492,39 @@ constexpr basic_Z<BaseInt, BaseIntBig, Allocator>::basic_Z(const basic_N_type &
     JMATHS_FUNCTION_TO_LOG;
 }
 
+/**
+ * @brief Fused signed multiply-add/subtract
+ * @param lhs First factor
+ * @param rhs Second factor
+ * @param subtract Subtract the product instead of adding it
+ * @param digit_offset Number of whole digits the product is shifted left by
+ *
+ * ALGORITHM:
+ * - Product sign = sign(lhs) XOR sign(rhs) XOR subtract
+ * - Same sign as *this: basic_N fused multiply-add on the magnitude
+ * - Opposite sign: basic_N fused multiply-subtract, flip sign if the product was larger
+ */
+template <typename BaseInt, typename BaseIntBig, typename Allocator>
+constexpr void basic_Z<BaseInt, BaseIntBig, Allocator>::opr_addmul_assign_(
+    const basic_Z & lhs,
+    const basic_Z & rhs,
+    bool subtract,
+    std::size_t digit_offset) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    const auto product_sign = static_cast<sign_bool>(lhs.sign_ ^ rhs.sign_ ^ subtract);
+
+    if (basic_N_type::is_zero()) { set_sign_(product_sign); }
+
+    if (this->sign_ == product_sign) {
+        basic_N_type::opr_addmul_assign_(lhs, rhs, digit_offset);
+    } else if (basic_N_type::opr_submul_assign_(lhs, rhs, digit_offset)) {
+        flip_sign();
+    }
+
+    if (is_zero()) { set_sign_(positive); }
+}
+
 /**
  * @brief Convert to string in specified base
  * @param base Numeric base (2-64)
@@ -795,6 +982,42 @@ basic_Z<BaseInt, BaseIntBig, Allocator>::operator^=(const basic_Z & rhs) {
     return *this;
 }
 
+template <typename BaseInt, typename BaseIntBig, typename Allocator>
+constexpr basic_Z<BaseInt, BaseIntBig, Allocator> &
+basic_Z<BaseInt, BaseIntBig, Allocator>::addmul(const basic_Z & a, const basic_Z & b) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    opr_addmul_assign_(a, b, false);
+    return *this;
+}
+
+template <typename BaseInt, typename BaseIntBig, typename Allocator>
+constexpr basic_Z<BaseInt, BaseIntBig, Allocator> &
+basic_Z<BaseInt, BaseIntBig, Allocator>::submul(const basic_Z & a, const basic_Z & b) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    opr_addmul_assign_(a, b, true);
+    return *this;
+}
+
+template <typename BaseInt, typename BaseIntBig, typename Allocator>
+constexpr basic_Z<BaseInt, BaseIntBig, Allocator> &
+basic_Z<BaseInt, BaseIntBig, Allocator>::fma_2exp(const basic_Z & a,
+                                                  const basic_Z & b,
+                                                  bitcount_t pos) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    const std::size_t digit_offset = pos / base_int_type_bits;
+
+    if (const bitcount_t residual = pos % base_int_type_bits; residual != 0U) {
+        opr_addmul_assign_(a << residual, b, false, digit_offset);
+    } else {
+        opr_addmul_assign_(a, b, false, digit_offset);
+    }
+
+    return *this;
+}
+
 /**
  * @brief Unary negation (const version)
  * @return New signed integer with flipped sign
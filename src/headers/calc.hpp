@@ -16,7 +16,17 @@
 
 #pragma once
 
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string>
+#include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "TMP.hpp"
 #include "declarations.hpp"
@@ -35,15 +45,18 @@ namespace jmaths {
  */
 struct calc {
     /**
-     * @brief Calculate Greatest Common Divisor using binary GCD algorithm
+     * @brief Calculate Greatest Common Divisor
      * @tparam basic_N_type_1 First arbitrary-precision unsigned integer type
      * @tparam basic_N_type_2 Second type (must decay to same as first)
      * @param a First number
      * @param b Second number
      * @return GCD(a, b)
      *
-     * ALGORITHM: Binary GCD (Stein's algorithm) - O(n log n)
-     * More efficient than Euclidean algorithm for binary computers.
+     * ALGORITHM: Selected by operand length
+     * - Operands of up to two digits: Euclid on native double-digit words
+     * - Longer operands: Lehmer's algorithm - the Euclidean steps are simulated on the
+     *   leading two digits and applied to the full numbers as one cofactor matrix
+     * COMPLEXITY: O(n²)
      * See calc_impl.hpp for detailed implementation.
      */
     template <TMP::instance_of<basic_N> basic_N_type_1,
@@ -51,13 +64,184 @@ struct calc {
     static constexpr auto gcd(basic_N_type_1 && a, basic_N_type_2 && b)
         -> std::decay_t<basic_N_type_1>;
 
+    /**
+     * @brief Calculate the Greatest Common Divisor of many numbers
+     * @param values The numbers
+     * @return GCD of all values (0 for an empty range or if all values are zero)
+     *
+     * ALGORITHM: Running GCD starting from the shortest value, so that every step reduces
+     * a value modulo a number that is no longer than the shortest one. Stops as soon as
+     * the running GCD is 1.
+     */
+    template <std::ranges::forward_range range_type>
+        requires TMP::instance_of<std::ranges::range_value_t<range_type>, basic_N>
+    static constexpr auto gcd(const range_type & values) -> std::ranges::range_value_t<range_type>;
+
+    /**
+     * @brief Calculate the Least Common Multiple
+     * @param a First number
+     * @param b Second number
+     * @return LCM(a, b), which is 0 if either number is 0
+     *
+     * ALGORITHM: a / GCD(a, b) × b, dividing the shorter operand
+     */
+    template <TMP::instance_of<basic_N> basic_N_type_1,
+              TMP::decays_to<basic_N_type_1> basic_N_type_2>
+    static constexpr auto lcm(basic_N_type_1 && a, basic_N_type_2 && b)
+        -> std::decay_t<basic_N_type_1>;
+
+    /**
+     * @brief Extended Euclidean algorithm
+     * @param a First number
+     * @param b Second number
+     * @return Tuple (g, s, t) with g = GCD(a, b) = s × a + t × b
+     *
+     * ALGORITHM: Lehmer's algorithm (see gcd()) tracking the cofactor of a; t is
+     * recovered at the end with one exact division
+     * The cofactors are the ones of the classical Euclidean algorithm, so
+     * |s| <= b / (2g) and |t| <= a / (2g) unless one of the operands divides the other.
+     * gcdext(0, 0) is (0, 0, 0).
+     */
+    template <TMP::instance_of<basic_N> basic_N_type_1,
+              TMP::decays_to<basic_N_type_1> basic_N_type_2>
+    static constexpr auto gcdext(basic_N_type_1 && a, basic_N_type_2 && b)
+        -> std::tuple<typename std::decay_t<basic_N_type_1>::basic_Z_type,
+                      typename std::decay_t<basic_N_type_1>::basic_Z_type,
+                      typename std::decay_t<basic_N_type_1>::basic_Z_type>;
+
+    /**
+     * @brief Calculate the modular inverse
+     * @param a Number to invert
+     * @param mod The modulus (must not be zero)
+     * @return x in [0, mod) with a × x ≡ 1 (mod mod), or std::nullopt if GCD(a, mod) != 1
+     * @throws error::division_by_zero if mod is zero
+     *
+     * ALGORITHM: Extended Lehmer GCD without the cofactor of mod
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr auto mod_inverse(basic_N_type && a, const std::decay_t<basic_N_type> & mod)
+        -> std::optional<std::decay_t<basic_N_type>>;
+
+    /**
+     * @brief Invert many numbers modulo the same modulus
+     * @param values Numbers to invert
+     * @param mod The modulus (must not be zero)
+     * @return The inverses in the order of values, or std::nullopt if any of the values is
+     * not invertible
+     * @throws error::division_by_zero if mod is zero
+     *
+     * ALGORITHM: Montgomery's trick - the prefix products are inverted with a single
+     * mod_inverse() and unwound, so n inverses cost one inversion and 3(n - 1) modular
+     * multiplications
+     */
+    template <std::ranges::forward_range range_type>
+        requires TMP::instance_of<std::ranges::range_value_t<range_type>, basic_N>
+    static constexpr auto batch_mod_inverse(const range_type & values,
+                                            const std::ranges::range_value_t<range_type> & mod)
+        -> std::optional<std::vector<std::ranges::range_value_t<range_type>>>;
+
+    /**
+     * @brief Calculate the GCD of every number with the product of all others
+     * @param values The numbers (must not be zero)
+     * @return For every value v_i, GCD(v_i, ∏_(j≠i) v_j), in the order of values
+     * @throws error::division_by_zero if any of the values is zero
+     *
+     * ALGORITHM: Batch GCD (Bernstein) - going down the product tree, every node c gets
+     * the product of all values outside c modulo c from its parent and its sibling, so
+     * the leaves hold ∏_(j≠i) v_j mod v_i and one GCD per value is left. This takes
+     * O(log k) levels of balanced products and divisions instead of k(k - 1) / 2
+     * pairwise GCDs.
+     */
+    template <std::ranges::forward_range range_type>
+        requires TMP::instance_of<std::ranges::range_value_t<range_type>, basic_N>
+    static constexpr auto batch_gcd(const range_type & values)
+        -> std::vector<std::ranges::range_value_t<range_type>>;
+
+    /**
+     * @brief Calculate the Jacobi symbol
+     * @param a The upper argument
+     * @param n The lower argument (must be odd)
+     * @return (a / n), which is 0 if GCD(a, n) != 1 and ±1 otherwise
+     * @throws error::invalid_modulus if n is even
+     *
+     * ALGORITHM: Binary Jacobi algorithm - factors of 2 are shifted out of a by ctz() with
+     * the sign rule for (2 / n), the larger operand is replaced by the difference and
+     * reciprocity is applied on every swap, without any division. Both operands shrink by
+     * at least one bit per step and switch to native words once they fit.
+     * COMPLEXITY: O(n²) limb operations, far below the O(n³) of Euler's criterion
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr int jacobi(const basic_N_type & a, const basic_N_type & n);
+
+    /**
+     * @brief Calculate the Kronecker symbol, the extension of the Jacobi symbol to any n
+     * @param a The upper argument
+     * @param n The lower argument
+     * @return (a / n), with (a / 2) = 0 for even a, 1 for a ≡ ±1 (mod 8), -1 for
+     * a ≡ ±3 (mod 8) and (a / 0) = 1 only for a = 1
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr int kronecker(const basic_N_type & a, const basic_N_type & n);
+
+    /**
+     * @brief Calculate a square root modulo a prime
+     * @param a The number (any size, it is reduced modulo p first)
+     * @param p The modulus (must be prime)
+     * @return r with r² ≡ a (mod p) and r ≤ p / 2, or std::nullopt if a is not a square
+     * modulo p. For an odd p that is not prime, the result is either such an r or
+     * std::nullopt, even if a has a square root modulo p, and always std::nullopt for a
+     * perfect square p and a ≢ 0.
+     * @throws error::division_by_zero if p is zero
+     * @throws error::invalid_modulus if p is even and not 2
+     *
+     * ALGORITHM: The Jacobi symbol rules out non-residues first. Then one exponentiation for
+     * p ≡ 3 (mod 4), Atkin's formula for p ≡ 5 (mod 8), and otherwise Tonelli-Shanks, or
+     * Cipolla's algorithm when p - 1 is divisible by a large power of 2 (2^s with
+     * s² > 16 × bits of p) where the O(s²) steps of Tonelli-Shanks would dominate
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr auto sqrt_mod(const basic_N_type & a, const basic_N_type & p)
+        -> std::optional<basic_N_type>;
+
+    /**
+     * @brief Multiply many numbers
+     * @param values The factors
+     * @return The product of all values (1 for an empty range)
+     *
+     * ALGORITHM: Balanced product tree - neighbouring numbers are multiplied pairwise,
+     * level by level, so that both operands of every multiplication have about the same
+     * length instead of one growing product absorbing one short factor at a time
+     */
+    template <std::ranges::forward_range range_type>
+        requires TMP::instance_of<std::ranges::range_value_t<range_type>, basic_N>
+    static constexpr auto product(const range_type & values)
+        -> std::ranges::range_value_t<range_type>;
+
+    /**
+     * @brief Reduce one number modulo many moduli
+     * @param num The number
+     * @param moduli The moduli (must not be zero)
+     * @return num mod m for every modulus m, in the order of moduli
+     * @throws error::division_by_zero if any of the moduli is zero
+     *
+     * ALGORITHM: Remainder tree - num is reduced modulo the product of all moduli once,
+     * and every remainder is reduced modulo the two halves of its node of the product tree
+     * on the way down to the moduli, so every division has balanced operands
+     */
+    template <std::ranges::forward_range range_type>
+        requires TMP::instance_of<std::ranges::range_value_t<range_type>, basic_N>
+    static constexpr auto remainder_tree(const std::ranges::range_value_t<range_type> & num,
+                                         const range_type & moduli)
+        -> std::vector<std::ranges::range_value_t<range_type>>;
+
     /**
      * @brief Calculate integer square root with remainder
      * @param num Number to take square root of
      * @return Pair of (sqrt, remainder) where num = sqrt² + remainder
      *
-     * ALGORITHM: Binary search - O(log n) iterations × O(n²) per multiplication
-     * Finds largest integer x such that x² ≤ num
+     * ALGORITHM: Newton's iteration with doubling precision, starting from the
+     * floating-point square root of the leading 54 bits
+     * Finds largest integer x such that x² ≤ num with O(log log num) divisions
      */
     template <TMP::instance_of<basic_N> basic_N_type>
     static constexpr auto sqrt(basic_N_type && num)
@@ -68,19 +252,302 @@ struct calc {
      * @param num Number to take square root of
      * @return Floor of square root
      *
-     * ALGORITHM: Similar to sqrt() but doesn't compute remainder
-     * Slightly more efficient when remainder is not needed
+     * ALGORITHM: Same as sqrt(), the remainder is dropped
      */
     template <TMP::instance_of<basic_N> basic_N_type>
     static constexpr auto sqrt_whole(basic_N_type && num) -> std::decay_t<basic_N_type>;
 
+    /**
+     * @brief Calculate integer k-th root with remainder
+     * @param num Number to take the root of
+     * @param k Degree of the root
+     * @return Pair of (root, remainder) where num = root^k + remainder and root is the
+     * largest integer with root^k ≤ num
+     * @throws error::division_by_zero if k is zero
+     *
+     * ALGORITHM: Newton's iteration x = ((k - 1)·x + num / x^(k-1)) / k from a
+     * floating-point estimate of the root; sqrt() for k = 2
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr auto root(basic_N_type && num, bitcount_t k)
+        -> std::pair<std::decay_t<basic_N_type>, std::decay_t<basic_N_type>>;
+
+    /**
+     * @brief Check if a number is a perfect square
+     * @param num The number
+     * @return true if num = a² for some a (0 and 1 included)
+     *
+     * ALGORITHM: The residues modulo 64, 63, 65 and 11 reject about 99% of non-squares
+     * with one pass over the limbs; the rest is decided by sqrt()
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr bool is_square(const basic_N_type & num);
+
+    /**
+     * @brief Check if a number is a perfect power
+     * @param num The number
+     * @return true if num = a^b for some a and b ≥ 2 (0 and 1 included)
+     *
+     * ALGORITHM: is_square(), then root() for every odd prime exponent p < num.bits().
+     * Exponents that do not divide the number of trailing zero bits are skipped, and most
+     * other non-powers are rejected by p-th power residues modulo primes q ≡ 1 (mod p)
+     * before any root is taken
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr bool is_perfect_power(const basic_N_type & num);
+
+    /**
+     * @brief Calculate the integer logarithm
+     * @param num The number (must not be zero)
+     * @param base The base (at least 2)
+     * @return floor(log_base(num)), so base^result ≤ num < base^(result + 1)
+     *
+     * ALGORITHM: Estimate from the leading 64 bits of both numbers, with one comparison
+     * against the power of the base only when the estimate is within 2^-40 of an integer
+     * COMPLEXITY: O(n) mostly, no conversion of num
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr auto ilog(const basic_N_type & num, const basic_N_type & base) -> bitcount_t;
+
+    /**
+     * @brief Calculate the integer logarithm to base 2
+     * @param num The number (must not be zero)
+     * @return floor(log₂(num)) = num.bits() - 1
+     * COMPLEXITY: O(1)
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr auto ilog2(const basic_N_type & num) -> bitcount_t;
+
+    /**
+     * @brief Calculate the integer logarithm to base 10
+     * @param num The number (must not be zero)
+     * @return floor(log₁₀(num)), one less than the number of decimal digits
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr auto ilog10(const basic_N_type & num) -> bitcount_t;
+
+    /**
+     * @brief Check if a number is probably prime
+     * @param num The number
+     * @param extra_rounds Number of Miller-Rabin rounds with random bases after the
+     * Baillie-PSW test
+     * @return false if num is composite; true if num is prime, which is proven for
+     * num < 1024² and holds for every known Baillie-PSW probable prime
+     *
+     * ALGORITHM: Trial division by the primes below 1024 (several primes per pass over
+     * the limbs), then the Baillie-PSW test - a strong probable prime test to base 2 and
+     * a strong Lucas test with Selfridge's parameters - and the extra rounds, all on one
+     * montgomery_context
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr bool is_probable_prime(const basic_N_type & num, unsigned extra_rounds = 0U);
+
+    /**
+     * @brief Find the next prime
+     * @param num The number to start after
+     * @param safe Only accept safe primes p, for which (p - 1) / 2 is prime as well
+     * @return The smallest (safe) probable prime greater than num, see is_probable_prime()
+     *
+     * ALGORITHM: Above 2^20, a sieve over a window of candidates removes those with a
+     * prime factor below 2^16 before any probable prime test. For safe primes the sieve
+     * also removes candidates p with a small factor in (p - 1) / 2 and keeps p ≡ 3 (mod 4),
+     * and both numbers get a strong base-2 test before the full test.
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr auto next_prime(const basic_N_type & num, bool safe = false) -> basic_N_type;
+
+    /**
+     * @brief Generate a random prime of a given length
+     * @tparam basic_N_type basic_N type of the result
+     * @param bits Bit length of the prime (at least 2, or 3 for safe primes)
+     * @param safe Only return safe primes p, for which (p - 1) / 2 is prime as well
+     * @return A (safe) probable prime p with 2^(bits-1) ≤ p < 2^bits
+     *
+     * ALGORITHM: next_prime() of a random number with the top bit set, repeated if the
+     * result is too long. Primes after long gaps are slightly more likely, as with every
+     * sieve-based generator.
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr auto random_prime(bitcount_t bits, bool safe = false) -> basic_N_type;
+
+    /**
+     * @brief Calculate a factorial
+     * @tparam basic_N_type basic_N type of the result
+     * @param n The number (below 2^32)
+     * @return n!
+     *
+     * ALGORITHM: Prime swing - n! = (⌊n/2⌋!)² × swing(n), where swing(n) is a product of
+     * prime powers below n that is multiplied as a balanced tree of native words. Each
+     * halving of n costs one squaring and one balanced product.
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr auto factorial(std::uint64_t n) -> basic_N_type;
+
+    /**
+     * @brief Calculate a multifactorial
+     * @tparam basic_N_type basic_N type of the result
+     * @param n The number
+     * @param m The step (nonzero)
+     * @return n × (n - m) × (n - 2m) × ... down to the last positive factor (1 if n = 0)
+     *
+     * ALGORITHM: factorial() for m = 1, (n/2)! × 2^(n/2) for m = 2 and even n, otherwise
+     * a balanced product tree of the factors
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr auto multifactorial(std::uint64_t n, std::uint64_t m) -> basic_N_type;
+
+    /**
+     * @brief Calculate a double factorial
+     * @tparam basic_N_type basic_N type of the result
+     * @param n The number
+     * @return n!! = multifactorial(n, 2)
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr auto double_factorial(std::uint64_t n) -> basic_N_type;
+
+    /**
+     * @brief Calculate a binomial coefficient
+     * @tparam basic_N_type basic_N type of the result
+     * @param n Size of the set (below 2^32 - 1 if both k and n - k are at least 2^26)
+     * @param k Size of the subsets
+     * @return n! / (k! × (n - k)!), 0 if k > n
+     *
+     * ALGORITHM: With k the smaller of k and n - k: for n < 2^26 or k ≥ 2^26, the prime
+     * factorisation from Kummer's theorem (the exponent of p is the number of borrows when
+     * subtracting k from n in base p) multiplied as a balanced tree; otherwise the product
+     * of the k top factors divided by k!
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr auto binomial(std::uint64_t n, std::uint64_t k) -> basic_N_type;
+
+    /**
+     * @brief Calculate a Fibonacci number
+     * @tparam basic_N_type basic_N type of the result
+     * @param n The index
+     * @return F(n), with F(0) = 0, F(1) = 1 and F(n + 2) = F(n + 1) + F(n)
+     *
+     * ALGORITHM: Fast doubling with two squarings per bit of n,
+     *     F(2k + 1) = 4F(k)² - F(k - 1)² + 2(-1)^k,    F(2k - 1) = F(k)² + F(k - 1)²
+     * and F(2k) as their difference
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr auto fibonacci(std::uint64_t n) -> basic_N_type;
+
+    /**
+     * @brief Calculate two consecutive Fibonacci numbers
+     * @tparam basic_N_type basic_N type of the result
+     * @param n The index
+     * @return Pair (F(n), F(n + 1)), at the cost of fibonacci(n + 1)
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr auto fibonacci_pair(std::uint64_t n) -> std::pair<basic_N_type, basic_N_type>;
+
+    /**
+     * @brief Calculate a Lucas number
+     * @tparam basic_N_type basic_N type of the result
+     * @param n The index
+     * @return L(n), with L(0) = 2, L(1) = 1 and L(n + 2) = L(n + 1) + L(n)
+     *
+     * ALGORITHM: L(n) = F(n) + 2F(n - 1) from the doubling of fibonacci()
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr auto lucas(std::uint64_t n) -> basic_N_type;
+
+    /**
+     * @brief Calculate two consecutive Lucas numbers
+     * @tparam basic_N_type basic_N type of the result
+     * @param n The index
+     * @return Pair (L(n), L(n + 1))
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr auto lucas_pair(std::uint64_t n) -> std::pair<basic_N_type, basic_N_type>;
+
+    /**
+     * @brief Calculate a Fibonacci number modulo a number
+     * @param n The index (any size)
+     * @param mod The modulus
+     * @return F(n) mod mod
+     * @throws error::division_by_zero if mod is zero
+     *
+     * ALGORITHM: The doubling of fibonacci() with every square reduced as in pow_mod()
+     * (Montgomery form for odd moduli, Barrett reduction for even moduli)
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr auto fibonacci_mod(const basic_N_type & n, const basic_N_type & mod)
+        -> basic_N_type;
+
+    /**
+     * @brief Calculate a Lucas number modulo a number
+     * @param n The index (any size)
+     * @param mod The modulus
+     * @return L(n) mod mod
+     * @throws error::division_by_zero if mod is zero
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr auto lucas_mod(const basic_N_type & n, const basic_N_type & mod)
+        -> basic_N_type;
+
+    /**
+     * @brief Evaluate a hypergeometric-type series by binary splitting
+     * @param first Index of the first term
+     * @param last Index one past the last term (last > first)
+     * @param term Callable with term(k) -> std::tuple{p(k), q(k), a(k)} of types basic_Z,
+     * basic_N and basic_Z (q(k) nonzero)
+     * @return Tuple (P, Q, T) with P = p(first)···p(last - 1), Q = q(first)···q(last - 1)
+     * and T / Q = Σ a(k) × p(first)···p(k) / (q(first)···q(k)) over first ≤ k < last
+     *
+     * ALGORITHM: Split [first, last) at the midpoint m and combine the halves with
+     * P = P₁P₂, Q = Q₁Q₂, T = T₁Q₂ + P₁T₂, so that the big multiplications are between
+     * numbers of similar size. P is not formed along the right edge, where it is not used.
+     * COMPLEXITY: O(M(n) log n) for an n-digit result, M being the multiplication cost
+     */
+    template <TMP::instance_of<basic_N> basic_N_type, typename term_type>
+    static constexpr auto binary_splitting(std::uint64_t first,
+                                           std::uint64_t last,
+                                           term_type && term)
+        -> std::tuple<typename basic_N_type::basic_Z_type,
+                      basic_N_type,
+                      typename basic_N_type::basic_Z_type>;
+
+    /**
+     * @brief Calculate π in decimal
+     * @param digits Number of digits after the decimal point
+     * @return "3.1415...", truncated (not rounded) after digits decimals
+     *
+     * ALGORITHM: Chudnovsky series, 14 digits per term, by binary_splitting(), then
+     * π = 426880 √10005 × Q / T with the square root from sqrt()
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr auto pi_str(std::size_t digits) -> std::string;
+
+    /**
+     * @brief Calculate e in decimal
+     * @param digits Number of digits after the decimal point
+     * @return "2.7182...", truncated (not rounded) after digits decimals
+     *
+     * ALGORITHM: e = Σ 1/k! by binary_splitting()
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr auto e_str(std::size_t digits) -> std::string;
+
+    /**
+     * @brief Calculate log 2 in decimal
+     * @param digits Number of digits after the decimal point
+     * @return "0.6931...", truncated (not rounded) after digits decimals
+     *
+     * ALGORITHM: log 2 = 18 atanh(1/26) - 2 atanh(1/4801) + 8 atanh(1/8749), each series
+     * by binary_splitting()
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr auto log2_str(std::size_t digits) -> std::string;
+
     /**
      * @brief Calculate power (exponentiation) for unsigned integers
      * @param base The base number
      * @param exponent The exponent (must be non-negative)
      * @return base^exponent
      *
-     * ALGORITHM: Exponentiation by squaring - O(log exponent)
+     * ALGORITHM: Sliding-window exponentiation - O(log exponent)
      * Much faster than repeated multiplication for large exponents
      */
     template <TMP::instance_of<basic_N> basic_N_type_1,
@@ -95,9 +562,11 @@ struct calc {
      * @param mod The modulus
      * @return (base^exponent) mod mod
      *
-     * ALGORITHM: Modular exponentiation by squaring - O(log exponent)
+     * ALGORITHM: Sliding-window modular exponentiation - O(log exponent)
      * Crucial for cryptographic applications (RSA, Diffie-Hellman, etc.)
      * Keeps intermediate results small to prevent overflow
+     * Odd moduli are handled by montgomery_context and even moduli by barrett_context,
+     * so no step needs a long division
      */
     template <TMP::instance_of<basic_N> basic_N_type_1,
               TMP::decays_to<basic_N_type_1> basic_N_type_2>
@@ -106,6 +575,46 @@ struct calc {
                                   const std::decay_t<basic_N_type_1> & mod)
         -> std::decay_t<basic_N_type_1>;
 
+    /**
+     * @brief Calculate modular exponentiation in constant time
+     * @param base The base number
+     * @param exponent The secret exponent, processed as a number of mod.bits() bits
+     * @param mod The modulus (must be odd)
+     * @return (base^exponent) mod mod
+     * @throws error::division_by_zero if mod is zero
+     * @throws error::invalid_modulus if mod is even
+     *
+     * Opt-in variant of pow_mod() for secret exponents (signatures, private keys): it
+     * does not branch on the exponent bits and reads every precomputed power in each
+     * window, so its running time does not depend on the exponent value as long as the
+     * exponent is shorter than the modulus.
+     * ALGORITHM: Fixed-window exponentiation, see montgomery_context::pow_ct()
+     */
+    template <TMP::instance_of<basic_N> basic_N_type_1,
+              TMP::decays_to<basic_N_type_1> basic_N_type_2>
+    static constexpr auto pow_mod_ct(basic_N_type_1 && base,
+                                     basic_N_type_2 && exponent,
+                                     const std::decay_t<basic_N_type_1> & mod)
+        -> std::decay_t<basic_N_type_1>;
+
+    /**
+     * @brief Calculate a product of modular powers
+     * @param bases The bases b_0, ..., b_(k-1)
+     * @param exponents The exponents e_0, ..., e_(k-1) (as many as bases)
+     * @param mod The modulus
+     * @return (b_0^e_0 × ... × b_(k-1)^e_(k-1)) mod mod
+     * @throws error::division_by_zero if mod is zero
+     *
+     * ALGORITHM: Multi-exponentiation (see multi_pow.hpp) - all terms share one chain of
+     * squarings, with interleaved sliding windows (Straus) for small batches and buckets
+     * (Pippenger) for large ones. Products are reduced as in pow_mod().
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr auto multi_pow_mod(
+        std::span<const std::type_identity_t<basic_N_type>> bases,
+        std::span<const std::type_identity_t<basic_N_type>> exponents,
+        const basic_N_type & mod) -> basic_N_type;
+
     /**
      * @brief Calculate power for signed integers
      * @param base The signed base number
@@ -117,6 +626,276 @@ struct calc {
     template <TMP::instance_of<basic_Z> basic_Z_type, TMP::instance_of<basic_N> basic_N_type>
     static constexpr auto pow(basic_Z_type && base, basic_N_type && exponent)
         -> std::decay_t<basic_Z_type>;
+
+   private:
+    // crt_basis builds its tree with product_tree_() and remainder_tree_()
+    template <TMP::instance_of<basic_N> T> friend class crt_basis;
+
+    /**
+     * @brief Extended Lehmer GCD that only tracks the cofactor of x
+     * @return Pair (g, s) with g = GCD(x, y) ≡ s × x (mod y)
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    [[nodiscard]] static constexpr auto gcdext_(basic_N_type x, basic_N_type y)
+        -> std::pair<basic_N_type, typename basic_N_type::basic_Z_type>;
+
+    /**
+     * @brief Integer square root of a nonzero number by Newton's iteration
+     * @return Pair (s, num - s²) with s = floor(sqrt(num))
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    [[nodiscard]] static constexpr auto sqrt_rem_(const basic_N_type & num)
+        -> std::pair<basic_N_type, basic_N_type>;
+
+    /**
+     * @brief Starting point for the Newton iteration of root()
+     * @return A positive number close to the k-th root of num
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    [[nodiscard]] static constexpr auto root_estimate_(const basic_N_type & num, bitcount_t k)
+        -> basic_N_type;
+
+    /**
+     * @brief num mod divisor for a nonzero 32-bit divisor, without changing num
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    [[nodiscard]] static constexpr std::uint32_t residue_(const basic_N_type & num,
+                                                          std::uint32_t divisor);
+
+    /**
+     * @brief num mod every prime of primes (each a nonzero 32-bit number), with the primes
+     * grouped into products below 2^32 and one residue_() per group
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    [[nodiscard]] static constexpr auto residues_(const basic_N_type & num,
+                                                  std::span<const std::uint32_t> primes)
+        -> std::vector<std::uint32_t>;
+
+    /**
+     * @brief Levels of the product tree of values (not empty), from the values up to their
+     * product
+     *
+     * Entry i of a level is the product of entries 2i and 2i + 1 of the level below, or
+     * entry 2i alone at the end of a level of odd length.
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    [[nodiscard]] static constexpr auto product_tree_(std::vector<basic_N_type> values)
+        -> std::vector<std::vector<basic_N_type>>;
+
+    /**
+     * @brief num mod every value at the bottom of a product tree of nonzero values, or num
+     * mod the square of every value if squared is set
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    [[nodiscard]] static constexpr auto remainder_tree_(
+        const basic_N_type & num,
+        const std::vector<std::vector<basic_N_type>> & tree,
+        bool squared = false) -> std::vector<basic_N_type>;
+
+    /**
+     * @brief Fast doubling of Fibonacci numbers in any representation
+     * @param n The index (n ≥ 1)
+     * @param one 1 in the representation
+     * @param two 2 in the representation
+     * @param sqr Squares its argument in place
+     * @param add add(x, y) sets x to x + y
+     * @param sub sub(x, y) sets x to x - y
+     * @return Pair (F(n), F(n - 1))
+     */
+    template <typename T, TMP::instance_of<basic_N> basic_N_type, typename sqr_type,
+              typename add_type, typename sub_type>
+    [[nodiscard]] static constexpr auto fibonacci_doubling_(const basic_N_type & n,
+                                                            const T & one,
+                                                            const T & two,
+                                                            sqr_type sqr,
+                                                            add_type add,
+                                                            sub_type sub) -> std::pair<T, T>;
+
+    /**
+     * @brief (F(n), F(n - 1)) for n ≥ 1
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    [[nodiscard]] static constexpr auto fibonacci_previous_(std::uint64_t n)
+        -> std::pair<basic_N_type, basic_N_type>;
+
+    /**
+     * @brief F(n) mod mod, or L(n) mod mod if lucas is set
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    [[nodiscard]] static constexpr auto fibonacci_mod_(const basic_N_type & n,
+                                                       const basic_N_type & mod,
+                                                       bool lucas) -> basic_N_type;
+
+    /**
+     * @brief binary_splitting() of [first, last), with P left empty unless need_p is set
+     */
+    template <TMP::instance_of<basic_N> basic_N_type, typename term_type>
+    [[nodiscard]] static constexpr auto binary_splitting_(std::uint64_t first,
+                                                          std::uint64_t last,
+                                                          term_type & term,
+                                                          bool need_p)
+        -> std::tuple<typename basic_N_type::basic_Z_type,
+                      basic_N_type,
+                      typename basic_N_type::basic_Z_type>;
+
+    /**
+     * @brief factor × num / den, less than 1 too small, from the high bits of num and den
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    [[nodiscard]] static constexpr auto scaled_ratio_(basic_N_type num,
+                                                      basic_N_type den,
+                                                      const basic_N_type & factor)
+        -> basic_N_type;
+
+    /**
+     * @brief Decimal string of a constant c from scaled(precision, 10^precision), which
+     * must be within 2 of c × 10^precision (c irrational, so that enough guard digits
+     * always decide the last digit)
+     */
+    template <TMP::instance_of<basic_N> basic_N_type, typename scaled_type>
+    [[nodiscard]] static constexpr auto constant_str_(std::size_t digits, scaled_type && scaled)
+        -> std::string;
+
+    /**
+     * @brief All primes below bound
+     */
+    [[nodiscard]] static constexpr auto primes_below_(std::uint32_t bound)
+        -> std::vector<std::uint32_t>;
+
+    /**
+     * @brief Product of native numbers as a balanced tree
+     *
+     * The factors are packed into words below 2^64 first, so that both operands of every
+     * big multiplication have about the same length.
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    [[nodiscard]] static constexpr auto product_native_(std::span<const std::uint64_t> factors)
+        -> basic_N_type;
+
+    /**
+     * @brief n! / (⌊n/2⌋!)², from the primes up to n
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    [[nodiscard]] static constexpr auto prime_swing_(std::uint64_t n,
+                                                     std::span<const std::uint32_t> primes)
+        -> basic_N_type;
+
+    /**
+     * @brief The primes below 1024
+     */
+    [[nodiscard]] static constexpr auto small_primes_() -> std::array<std::uint32_t, 172U>;
+
+    /**
+     * @brief Trial division by small_primes_()
+     * @return false if a prime divides num (num itself excluded), true if num < 1024² has
+     * no prime factor, std::nullopt if num is larger and has no small factor
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    [[nodiscard]] static constexpr std::optional<bool> trial_division_(const basic_N_type & num);
+
+    /**
+     * @brief Smallest (safe) probable prime p ≥ start with at most max_bits bits
+     * @return std::nullopt if there is none below 2^max_bits
+     * PRECONDITION: start ≥ 2^20
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    [[nodiscard]] static constexpr std::optional<basic_N_type> sieve_prime_(basic_N_type start,
+                                                                            bitcount_t max_bits,
+                                                                            bool safe);
+
+    /**
+     * @brief Miller-Rabin test: is the modulus of ctx a strong probable prime to base?
+     * PRECONDITION: 1 < base < modulus - 1
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    [[nodiscard]] static constexpr bool strong_probable_prime_(
+        const montgomery_context<basic_N_type> & ctx, const basic_N_type & base);
+
+    /**
+     * @brief Strong Lucas test with Selfridge's parameters on the modulus of ctx
+     * PRECONDITION: the modulus is not a perfect square and has no factor below 1024
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    [[nodiscard]] static constexpr bool strong_lucas_probable_prime_(
+        const montgomery_context<basic_N_type> & ctx);
+
+    /**
+     * @brief Tonelli-Shanks square root of a residue a (a < p, (a / p) = 1) modulo the prime of
+     * ctx, which must not be a perfect square
+     * @return The root, or std::nullopt if the modulus turns out not to be prime
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    [[nodiscard]] static constexpr auto tonelli_shanks_(
+        const montgomery_context<basic_N_type> & ctx, const basic_N_type & a)
+        -> std::optional<basic_N_type>;
+
+    /**
+     * @brief Cipolla square root of a residue a (a < p, (a / p) = 1) modulo the prime of
+     * ctx, which must not be a perfect square
+     * @return The root, or std::nullopt if the modulus turns out not to be prime
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    [[nodiscard]] static constexpr auto cipolla_(const montgomery_context<basic_N_type> & ctx,
+                                                 const basic_N_type & a)
+        -> std::optional<basic_N_type>;
+
+    /**
+     * @brief Jacobi symbol (a / n) of native numbers, n odd
+     */
+    [[nodiscard]] static constexpr int jacobi_native_(std::uint64_t a, std::uint64_t n);
+
+    /**
+     * @brief Floor of the square root of a number below 2^54
+     */
+    [[nodiscard]] static constexpr std::uint64_t sqrt_native_(std::uint64_t num);
+
+    /**
+     * @brief x = (x × y) mod mod
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr void mul_mod_(basic_N_type & x,
+                                   const basic_N_type & y,
+                                   const basic_N_type & mod);
+
+    /**
+     * @brief Extract the bits [shift, shift + lehmer_bits_) of a number
+     * @return The bits as a double-digit word (zero-extended past the top of num)
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    [[nodiscard]] static constexpr auto leading_bits_(const basic_N_type & num, bitcount_t shift)
+        -> typename basic_N_type::base_int_big_type;
+
+    /**
+     * @brief Simulate Euclid on the leading bits of x and y (inner loop of Lehmer's GCD)
+     * @param x_hat Leading bits of x
+     * @param y_hat Leading bits of y, taken at the same position (y <= x)
+     * @return Cofactor matrix {A, B, C, D} of the steps that are valid for the full numbers;
+     * B == 0 if not even one step could be determined
+     */
+    template <std::signed_integral cofactor_type>
+    [[nodiscard]] static constexpr auto lehmer_matrix_(cofactor_type x_hat, cofactor_type y_hat)
+        -> std::array<cofactor_type, 4U>;
+
+    /**
+     * @brief Compute out = p × x + q × y for cofactors of opposite sign
+     * PRECONDITION: p × x + q × y >= 0
+     * @param factor Scratch number reused to hold the cofactors
+     */
+    template <TMP::instance_of<basic_N> basic_N_type, std::signed_integral cofactor_type>
+    static constexpr void apply_cofactors_(basic_N_type & out,
+                                           const basic_N_type & x,
+                                           cofactor_type p,
+                                           const basic_N_type & y,
+                                           cofactor_type q,
+                                           basic_N_type & factor);
+
+    /**
+     * @brief Number of leading bits simulated per Lehmer step for a given digit width
+     * Two bits below a double digit, so that the sums of leading bits and cofactors in the
+     * inner loop fit in the signed double-digit type
+     */
+    template <TMP::instance_of<basic_N> basic_N_type>
+    static constexpr bitcount_t lehmer_bits_ = 2U * basic_N_type::base_int_type_bits - 3U;
 };  // struct calc
 
 }  // namespace jmaths
@@ -17,18 +17,35 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <tuple>
 #include <ratio>
+#include <span>
+#include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "TMP.hpp"
+#include "barrett.hpp"
 #include "basic_N.hpp"
 #include "basic_Z.hpp"
 #include "calc.hpp"
 #include "constants_and_types.hpp"
 #include "def.hh"
 #include "error.hpp"
+#include "montgomery.hpp"
+#include "multi_pow.hpp"
+#include "rand.hpp"
+#include "sliding_window.hpp"
 
 // member functions of calc
 namespace jmaths {
@@ -37,255 +54,2237 @@ template <TMP::instance_of<basic_N> basic_N_type_1, TMP::decays_to<basic_N_type_
 constexpr auto calc::gcd(basic_N_type_1 && a, basic_N_type_2 && b) -> std::decay_t<basic_N_type_1> {
     JMATHS_FUNCTION_TO_LOG;
 
-    // ALGORITHM: Binary GCD (Stein's algorithm)
-    // This is an efficient algorithm for computing the Greatest Common Divisor (GCD)
-    // of two integers. It's faster than the Euclidean algorithm for binary computers
-    // because it uses bit shifts and subtraction instead of division.
+    // ALGORITHM: Lehmer's GCD with double-digit leading parts (Knuth, TAOCP Vol. 2,
+    // Algorithm 4.5.2L)
     //
-    // The algorithm is based on these properties:
-    // 1. gcd(0, n) = n
-    // 2. If both numbers are even: gcd(2a, 2b) = 2 * gcd(a, b)
-    // 3. If one is even and one is odd: gcd(2a, b) = gcd(a, b) where b is odd
-    // 4. If both are odd: gcd(a, b) = gcd(|a-b|, min(a,b))
+    // Most Euclidean steps only depend on the leading bits of the operands. Lehmer's
+    // algorithm therefore runs Euclid on x̂ and ŷ, the leading lehmer_bits_ bits of x
+    // and y (taken at the same position), and tracks the cofactor matrix
+    //     | A B |
+    //     | C D |   with x_i = A × x + B × y and y_i = C × x + D × y
+    // A step is only accepted if the quotient is the same for both extremes of the
+    // unknown lower bits, i.e. if (x̂ + A) / (ŷ + C) == (x̂ + B) / (ŷ + D).
+    // When the simulation stops, the matrix is applied to the full numbers, which
+    // replaces several full-length subtractions by four multiplications by a double
+    // digit. If not even one step could be simulated (B == 0, the quotient is too large
+    // to be determined from the leading bits) a full division step is done instead.
     //
-    // Steps:
-    // 1. Handle base cases (either number is 0)
-    // 2. Find common factor of 2 by counting trailing zeros in both numbers
-    // 3. Remove all factors of 2 from both numbers
-    // 4. Repeatedly subtract smaller from larger and remove factors of 2
-    // 5. Multiply result by the common factor of 2 found in step 2
+    // Once x fits in a double digit the remaining steps are done on native words.
 
     using basic_N_t = std::decay_t<basic_N_type_1>;
+    using base_int_big_t = typename basic_N_t::base_int_big_type;
+    using cofactor_t = std::make_signed_t<base_int_big_t>;
 
     if (a.is_zero()) { return std::forward<decltype(b)>(b); }
     if (b.is_zero()) { return std::forward<decltype(a)>(a); }
 
-    TMP::ref_or_copy_t<decltype(a)> num1 = a;
-    TMP::ref_or_copy_t<decltype(b)> num2 = b;
+    basic_N_t x = std::forward<decltype(a)>(a);
+    basic_N_t y = std::forward<decltype(b)>(b);
 
-    // Count trailing zeros (factors of 2) in both numbers
-    const bitcount_t i = num1.ctz();
-    const bitcount_t j = num2.ctz();
+    // invariant: x >= y
+    if (basic_N_t::detail::opr_comp(x, y) < 0) { x.digits_.swap(y.digits_); }
 
-    // Remove all factors of 2 from both numbers
-    num1.opr_bitshift_r_assign_(i);
-    num2.opr_bitshift_r_assign_(j);
+    // reused by every step, so the loop stops allocating once they are large enough
+    basic_N_t next_x;
+    basic_N_t next_y;
+    basic_N_t factor;
 
-    // k = common power of 2 that divides both numbers
-    const bitcount_t k = std::min(i, j);
+    while (x.digits_.size() > 2U) {
+        if (y.is_zero()) { return x; }
+
+        const bitcount_t shift = x.bits() - lehmer_bits_<basic_N_t>;
+
+        const auto [A, B, C, D] = lehmer_matrix_(static_cast<cofactor_t>(leading_bits_(x, shift)),
+                                                 static_cast<cofactor_t>(leading_bits_(y, shift)));
+
+        if (B == 0) {
+            // x, y = y, x mod y
+            x = basic_N_t::detail::opr_div(x, y).second;
+            x.digits_.swap(y.digits_);
+        } else {
+            apply_cofactors_(next_x, x, A, y, B, factor);
+            apply_cofactors_(next_y, x, C, y, D, factor);
+            x.digits_.swap(next_x.digits_);
+            y.digits_.swap(next_y.digits_);
+        }
+    }
+
+    return basic_N_t{std::gcd(x.template fits_into<base_int_big_t>().value(),
+                              y.template fits_into<base_int_big_t>().value())};
+}
+
+template <std::ranges::forward_range range_type>
+    requires TMP::instance_of<std::ranges::range_value_t<range_type>, basic_N>
+constexpr auto calc::gcd(const range_type & values) -> std::ranges::range_value_t<range_type> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    using basic_N_t = std::ranges::range_value_t<range_type>;
+
+    // the shortest nonzero value bounds the running GCD from the start
+    auto shortest = std::ranges::end(values);
+    for (auto it = std::ranges::begin(values); it != std::ranges::end(values); ++it) {
+        if (it->is_zero()) { continue; }
+        if (shortest == std::ranges::end(values) || it->bits() < shortest->bits()) { shortest = it; }
+    }
+
+    if (shortest == std::ranges::end(values)) { return basic_N_t{}; }
+
+    basic_N_t result = *shortest;
+
+    for (auto it = std::ranges::begin(values); it != std::ranges::end(values); ++it) {
+        if (result.is_one()) { break; }
+        if (it == shortest) { continue; }
+        result = gcd(std::move(result), *it);
+    }
+
+    return result;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type_1, TMP::decays_to<basic_N_type_1> basic_N_type_2>
+constexpr auto calc::lcm(basic_N_type_1 && a, basic_N_type_2 && b) -> std::decay_t<basic_N_type_1> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    using basic_N_t = std::decay_t<basic_N_type_1>;
+
+    if (a.is_zero() || b.is_zero()) { return basic_N_t{}; }
+
+    const basic_N_t g = gcd(a, b);
+
+    // the exact division on the shorter operand, the product with the longer one
+    if (a.bits() <= b.bits()) {
+        basic_N_t result = basic_N_t::detail::opr_div(a, g).first;
+        result.opr_mult_assign_(b);
+        return result;
+    }
+
+    basic_N_t result = basic_N_t::detail::opr_div(b, g).first;
+    result.opr_mult_assign_(a);
+    return result;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type_1, TMP::decays_to<basic_N_type_1> basic_N_type_2>
+constexpr auto calc::gcdext(basic_N_type_1 && a, basic_N_type_2 && b)
+    -> std::tuple<typename std::decay_t<basic_N_type_1>::basic_Z_type,
+                  typename std::decay_t<basic_N_type_1>::basic_Z_type,
+                  typename std::decay_t<basic_N_type_1>::basic_Z_type> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    using basic_N_t = std::decay_t<basic_N_type_1>;
+    using basic_Z_t = typename basic_N_t::basic_Z_type;
+
+    auto [g, s] = gcdext_<basic_N_t>(a, b);
+
+    basic_Z_t g_z{std::move(g)};
+    basic_Z_t t;
+
+    // t = (g - s × a) / b, the division is exact
+    if (!b.is_zero()) {
+        t = g_z;
+        t.opr_addmul_assign_(s, basic_Z_t{std::forward<decltype(a)>(a)}, true);
+        t = basic_Z_t::detail::opr_div(t, basic_Z_t{std::forward<decltype(b)>(b)}).first;
+    }
+
+    return {std::move(g_z), std::move(s), std::move(t)};
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::mod_inverse(basic_N_type && a, const std::decay_t<basic_N_type> & mod)
+    -> std::optional<std::decay_t<basic_N_type>> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    using basic_N_t = std::decay_t<basic_N_type>;
+
+    error::division_by_zero::check(mod);
+
+    basic_N_t a_num = std::forward<decltype(a)>(a);
+    if (basic_N_t::detail::opr_comp(a_num, mod) >= 0) {
+        a_num = basic_N_t::detail::opr_div(a_num, mod).second;
+    }
+
+    auto [g, s] = gcdext_<basic_N_t>(std::move(a_num), mod);
+
+    if (!g.is_one()) {
+        // every number is congruent to 0 modulo 1, and 0 × 0 ≡ 1 (mod 1)
+        if (mod.is_one()) { return basic_N_t{}; }
+        return std::nullopt;
+    }
+
+    // |s| <= mod / 2, so a negative cofactor only needs one addition of mod
+    if (s.is_negative()) { return mod - std::move(s).abs(); }
+    return std::move(s).abs();
+}
+
+template <std::ranges::forward_range range_type>
+    requires TMP::instance_of<std::ranges::range_value_t<range_type>, basic_N>
+constexpr auto calc::batch_mod_inverse(const range_type & values,
+                                       const std::ranges::range_value_t<range_type> & mod)
+    -> std::optional<std::vector<std::ranges::range_value_t<range_type>>> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // ALGORITHM: Montgomery's trick
+    // With prefix products p_i = v_0 × ... × v_i, a single inversion of p_(n-1) gives
+    // all inverses by walking backwards:
+    //     v_i^-1 = p_(i-1) × p_i^-1    and    p_(i-1)^-1 = v_i × p_i^-1
+    // The product is invertible if and only if every value is.
+
+    using basic_N_t = std::ranges::range_value_t<range_type>;
+
+    error::division_by_zero::check(mod);
+
+    // result first holds the reduced values, which are replaced by their inverses
+    std::vector<basic_N_t> result;
+    std::vector<basic_N_t> prefix;
+
+    for (const auto & value : values) {
+        basic_N_t & reduced = result.emplace_back(value);
+        if (basic_N_t::detail::opr_comp(reduced, mod) >= 0) {
+            reduced = basic_N_t::detail::opr_div(reduced, mod).second;
+        }
+
+        if (prefix.empty()) {
+            prefix.push_back(reduced);
+        } else {
+            basic_N_t & product = prefix.emplace_back(prefix.back());
+            mul_mod_(product, reduced, mod);
+        }
+    }
+
+    if (result.empty()) { return result; }
+
+    auto inverse = mod_inverse(std::move(prefix.back()), mod);
+    if (!inverse) { return std::nullopt; }
+
+    basic_N_t & inv = *inverse;
+
+    for (std::size_t i = result.size() - 1U; i > 0U; --i) {
+        basic_N_t value_inv = prefix[i - 1U];
+        mul_mod_(value_inv, inv, mod);
+        mul_mod_(inv, result[i], mod);
+        result[i] = std::move(value_inv);
+    }
+
+    result.front() = std::move(inv);
+
+    return result;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr int calc::jacobi(const basic_N_type & a, const basic_N_type & n) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    if (!n.is_odd()) { throw error::invalid_modulus("The Jacobi symbol needs an odd modulus!"); }
+
+    // ALGORITHM: Binary Jacobi algorithm on (x / y), y odd
+    //     (x / y) = (2 / y)^t × (x / 2^t / y)     (2 / y) = -1 for y ≡ 3, 5 (mod 8)
+    //     (x / y) = (x - y / y)
+    //     (x / y) = (y / x) × (-1)^((x - 1)(y - 1) / 4) for odd x and y
+    // Every step shifts at least one bit out of the larger operand.
+
+    basic_N_type x = a;
+    basic_N_type y = n;
+    int result = 1;
+
+    const auto low_bits = [](const basic_N_type & num) -> unsigned {
+        return num.is_zero() ? 0U : static_cast<unsigned>(num.digits_.front() & 7U);
+    };
+
+    for (;;) {
+        const auto x_small = x.template fits_into<std::uint64_t>();
+        const auto y_small = y.template fits_into<std::uint64_t>();
+        if (x_small && y_small) { return result * jacobi_native_(*x_small, *y_small); }
+
+        if (x.is_zero()) { return 0; }  // y is not 1, it does not fit into 64 bits
+
+        const bitcount_t shift = x.ctz();
+        if (shift != 0U) {
+            x.opr_bitshift_r_assign_(shift);
+            const unsigned y_mod_8 = low_bits(y);
+            if (shift % 2U == 1U && (y_mod_8 == 3U || y_mod_8 == 5U)) { result = -result; }
+        }
+
+        if (basic_N_type::detail::opr_comp(x, y) < 0) {
+            std::swap(x, y);
+            if ((low_bits(x) & 3U) == 3U && (low_bits(y) & 3U) == 3U) { result = -result; }
+        }
+
+        x.opr_subtr_assign_(y);
+    }
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr int calc::kronecker(const basic_N_type & a, const basic_N_type & n) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    if (n.is_zero()) { return a.is_one() ? 1 : 0; }
+
+    // (a / 2^e × m) = (a / 2)^e × (a / m)
+    const bitcount_t e = n.ctz();
+    int result = 1;
+
+    if (e != 0U) {
+        if (!a.is_odd()) { return 0; }
+        const auto a_mod_8 = static_cast<unsigned>(a.digits_.front() & 7U);
+        if (e % 2U == 1U && (a_mod_8 == 3U || a_mod_8 == 5U)) { result = -1; }
+    }
+
+    return result * jacobi(a, n >> e);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::sqrt_mod(const basic_N_type & a, const basic_N_type & p)
+    -> std::optional<basic_N_type> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    error::division_by_zero::check(p);
+
+    basic_N_type x = a;
+    if (basic_N_type::detail::opr_comp(x, p) >= 0) {
+        x = basic_N_type::detail::opr_div(x, p).second;
+    }
+
+    if (!p.is_odd()) {
+        if (p != basic_N_type{2U}) {
+            throw error::invalid_modulus("A square root modulo a prime needs an odd prime or 2!");
+        }
+        return x;
+    }
+
+    if (x.is_zero()) { return x; }
+    // (z / p) is never -1 for a square p, so no non-residue could be found below
+    if (is_square(p) || jacobi(x, p) != 1) { return std::nullopt; }
+
+    const montgomery_context<basic_N_type> ctx{p};
+    const auto p_mod_8 = static_cast<unsigned>(p.digits_.front() & 7U);
+
+    basic_N_type root;
+
+    if (p_mod_8 % 4U == 3U) {
+        // r = a^((p + 1) / 4), since a^((p - 1) / 2) = 1
+        root = ctx.pow(x, (p >> 2U) + basic_N_type::one_);
+    } else if (p_mod_8 == 5U) {
+        // Atkin: with v = (2a)^((p - 5) / 8) and i = 2a × v² (a square root of -1),
+        // r = a × v × (i - 1)
+        const basic_N_type a_m = ctx.to_montgomery(x);
+        basic_N_type two_a = a_m;
+        two_a.opr_add_assign_(a_m);
+        if (basic_N_type::detail::opr_comp(two_a, p) >= 0) { two_a.opr_subtr_assign_(p); }
+
+        const basic_N_type v = ctx.to_montgomery(ctx.pow(ctx.from_montgomery(two_a), p >> 3U));
+        basic_N_type i = ctx.mul(two_a, ctx.mul(v, v));
+
+        const basic_N_type one_m = ctx.to_montgomery(basic_N_type::one_);
+        if (basic_N_type::detail::opr_comp(i, one_m) < 0) { i.opr_add_assign_(p); }
+        i.opr_subtr_assign_(one_m);
+
+        root = ctx.from_montgomery(ctx.mul(ctx.mul(a_m, v), i));
+    } else {
+        const basic_N_type p_minus_1 = p - basic_N_type::one_;
+        const bitcount_t s = p_minus_1.ctz();
+        // measured crossover: s ≈ 70 for 256-bit and s ≈ 128 for 1024-bit primes
+        auto found = s * s > 16U * p.bits() ? cipolla_(ctx, x) : tonelli_shanks_(ctx, x);
+        if (!found) { return std::nullopt; }
+        root = *std::move(found);
+    }
+
+    // the smaller of the two roots, and no root at all if p is not prime after all (the
+    // formulas above then need not give a root)
+    basic_N_type other = p - root;
+    if (basic_N_type::detail::opr_comp(other, root) < 0) { root = std::move(other); }
+
+    if (ctx.from_montgomery(ctx.mul(ctx.to_montgomery(root), ctx.to_montgomery(root))) != x) {
+        return std::nullopt;
+    }
+
+    return root;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::fibonacci(std::uint64_t n) -> basic_N_type {
+    JMATHS_FUNCTION_TO_LOG;
+
+    if (n == 0U) { return basic_N_type{}; }
+
+    return fibonacci_previous_<basic_N_type>(n).first;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::fibonacci_pair(std::uint64_t n) -> std::pair<basic_N_type, basic_N_type> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    auto [next, current] = fibonacci_previous_<basic_N_type>(n + 1U);
+
+    return {std::move(current), std::move(next)};
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::lucas(std::uint64_t n) -> basic_N_type {
+    JMATHS_FUNCTION_TO_LOG;
+
+    if (n == 0U) { return basic_N_type{2U}; }
+
+    // L(n) = F(n + 1) + F(n - 1) = F(n) + 2F(n - 1)
+    auto [current, previous] = fibonacci_previous_<basic_N_type>(n);
+    previous.opr_bitshift_l_assign_(1U);
+    current.opr_add_assign_(previous);
+
+    return current;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::lucas_pair(std::uint64_t n) -> std::pair<basic_N_type, basic_N_type> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // with F(n + 1) and F(n):
+    //     L(n) = 2F(n + 1) - F(n),    L(n + 1) = F(n + 1) + 2F(n)
+    auto [next, current] = fibonacci_previous_<basic_N_type>(n + 1U);
+
+    basic_N_type lucas_current = next;
+    lucas_current.opr_bitshift_l_assign_(1U);
+    lucas_current.opr_subtr_assign_(current);
+
+    current.opr_bitshift_l_assign_(1U);
+    next.opr_add_assign_(current);
+
+    return {std::move(lucas_current), std::move(next)};
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::fibonacci_mod(const basic_N_type & n, const basic_N_type & mod)
+    -> basic_N_type {
+    JMATHS_FUNCTION_TO_LOG;
+
+    return fibonacci_mod_(n, mod, false);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::lucas_mod(const basic_N_type & n, const basic_N_type & mod)
+    -> basic_N_type {
+    JMATHS_FUNCTION_TO_LOG;
+
+    return fibonacci_mod_(n, mod, true);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type, typename term_type>
+constexpr auto calc::binary_splitting(std::uint64_t first, std::uint64_t last, term_type && term)
+    -> std::tuple<typename basic_N_type::basic_Z_type,
+                  basic_N_type,
+                  typename basic_N_type::basic_Z_type> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    assert(first < last);
+
+    return binary_splitting_<basic_N_type>(first, last, term, true);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::pi_str(std::size_t digits) -> std::string {
+    JMATHS_FUNCTION_TO_LOG;
+
+    using basic_Z_t = typename basic_N_type::basic_Z_type;
+
+    // Chudnovsky: 1/π = 12 Σ (-1)^k (6k)! (13591409 + 545140134k) / ((3k)! (k!)³ 640320^(3k + 3/2))
+    // term k over term k - 1 is -(6k - 5)(2k - 1)(6k - 1) / (k³ × 640320³ / 24), which is
+    // about -1/151931373056000 (14.18 digits)
+    const auto term = [](std::uint64_t k) -> std::tuple<basic_Z_t, basic_N_type, basic_Z_t> {
+        if (k == 0U) { return {basic_Z_t{1}, basic_N_type{1U}, basic_Z_t{13591409}}; }
+
+        basic_N_type p{6U * k - 5U};
+        p.opr_mult_assign_(basic_N_type{2U * k - 1U});
+        p.opr_mult_assign_(basic_N_type{6U * k - 1U});
+
+        basic_N_type q{k};
+        q.opr_mult_assign_(basic_N_type{k});
+        q.opr_mult_assign_(basic_N_type{k});
+        q.opr_mult_assign_(basic_N_type{10939058860032000U});
+
+        basic_N_type a{k};
+        a.opr_mult_assign_(basic_N_type{545140134U});
+        a.opr_add_assign_(basic_N_type{13591409U});
+
+        return {-basic_Z_t{std::move(p)}, std::move(q), basic_Z_t{std::move(a)}};
+    };
+
+    return constant_str_<basic_N_type>(
+        digits, [&term](std::size_t precision, const basic_N_type & scale) {
+            const auto [p, q, t] =
+                binary_splitting_<basic_N_type>(0U, precision / 14U + 2U, term, false);
+
+            // π × 10^precision = 426880 √(10005 × 10^(2 precision)) × Q / T, where the
+            // floor of the square root costs less than 426880 Q / T = π / √10005 < 1
+            basic_N_type root = scale;
+            root.opr_mult_assign_(scale);
+            root.opr_mult_assign_(basic_N_type{10005U});
+            root = sqrt_whole(std::move(root));
+            root.opr_mult_assign_(basic_N_type{426880U});
+
+            return scaled_ratio_(q, t.abs(), root);
+        });
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::e_str(std::size_t digits) -> std::string {
+    JMATHS_FUNCTION_TO_LOG;
+
+    using basic_Z_t = typename basic_N_type::basic_Z_type;
+
+    // term k over term k - 1 is 1 / k
+    const auto term = [](std::uint64_t k) -> std::tuple<basic_Z_t, basic_N_type, basic_Z_t> {
+        return {basic_Z_t{1}, basic_N_type{k == 0U ? 1U : k}, basic_Z_t{1}};
+    };
+
+    return constant_str_<basic_N_type>(
+        digits, [&term](std::size_t precision, const basic_N_type & scale) {
+            // the terms from 1/n! on add up to less than 2/n!, so n! ≥ 2^(bits) with
+            // 2^bits > 2 × 10^precision is enough
+            const bitcount_t bits = precision * 3322U / 1000U + 2U;
+            std::uint64_t terms = 1U;
+            bitcount_t factorial_bits = 0U;  // lower bound of log2(terms!)
+            while (factorial_bits < bits) {
+                ++terms;
+                factorial_bits += static_cast<bitcount_t>(std::bit_width(terms)) - 1U;
+            }
+
+            const auto [p, q, t] = binary_splitting_<basic_N_type>(0U, terms, term, false);
+
+            return scaled_ratio_(t.abs(), q, scale);
+        });
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::log2_str(std::size_t digits) -> std::string {
+    JMATHS_FUNCTION_TO_LOG;
+
+    using basic_Z_t = typename basic_N_type::basic_Z_type;
+
+    return constant_str_<basic_N_type>(
+        digits, [](std::size_t precision, const basic_N_type & scale) {
+            const bitcount_t bits = precision * 3322U / 1000U + 8U;
+
+            // c × atanh(1/x) × 10^precision for c ≤ 72, less than 2 too small
+            const auto atanh_inverse = [bits, &scale](std::uint64_t x, std::uint64_t c) {
+                // atanh(1/x) = Σ 1 / ((2k + 1) x^(2k + 1)), term k over term k - 1 is
+                // (2k - 1) / ((2k + 1) x²); the terms from k = n on add up to less than
+                // 2 x^-2n ≤ 2^-(bits - 1)
+                const std::uint64_t x_squared = x * x;
+                const std::uint64_t terms =
+                    bits / static_cast<bitcount_t>(std::bit_width(x_squared) - 1) + 1U;
+                const auto term = [x, x_squared](std::uint64_t k)
+                    -> std::tuple<basic_Z_t, basic_N_type, basic_Z_t> {
+                    if (k == 0U) { return {basic_Z_t{1}, basic_N_type{x}, basic_Z_t{1}}; }
+                    return {basic_Z_t{2U * k - 1U},
+                            basic_N_type{(2U * k + 1U) * x_squared},
+                            basic_Z_t{1}};
+                };
+
+                const auto [p, q, t] = binary_splitting_<basic_N_type>(0U, terms, term, false);
+
+                basic_N_type factor = scale;
+                factor.opr_mult_assign_(basic_N_type{c});
+                return scaled_ratio_(t.abs(), q, factor);
+            };
+
+            // log 2 = 18 atanh(1/26) - 2 atanh(1/4801) + 8 atanh(1/8749), evaluated 4 times
+            // over so that the three errors add up to less than 1 after the shift
+            basic_N_type sum = atanh_inverse(26U, 72U);
+            sum.opr_add_assign_(atanh_inverse(8749U, 32U));
+            sum.opr_subtr_assign_(atanh_inverse(4801U, 8U));
+            return sum.opr_bitshift_r_(2U);
+        });
+}
+
+template <std::ranges::forward_range range_type>
+    requires TMP::instance_of<std::ranges::range_value_t<range_type>, basic_N>
+constexpr auto calc::product(const range_type & values) -> std::ranges::range_value_t<range_type> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    using basic_N_t = std::ranges::range_value_t<range_type>;
+
+    std::vector<basic_N_t> level;
+    for (const auto & value : values) { level.push_back(value); }
+
+    if (level.empty()) { return basic_N_t::one_; }
+
+    // one level of the product tree at a time, in place
+    while (level.size() > 1U) {
+        const std::size_t pairs = level.size() / 2U;
+        for (std::size_t i = 0U; i < pairs; ++i) {
+            level[i] = std::move(level[2U * i]);
+            level[i].opr_mult_assign_(level[2U * i + 1U]);
+        }
+        if (level.size() % 2U == 1U) { level[pairs] = std::move(level.back()); }
+
+        level.resize((level.size() + 1U) / 2U);
+    }
+
+    return std::move(level.front());
+}
+
+template <std::ranges::forward_range range_type>
+    requires TMP::instance_of<std::ranges::range_value_t<range_type>, basic_N>
+constexpr auto calc::remainder_tree(const std::ranges::range_value_t<range_type> & num,
+                                    const range_type & moduli)
+    -> std::vector<std::ranges::range_value_t<range_type>> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    using basic_N_t = std::ranges::range_value_t<range_type>;
+
+    std::vector<basic_N_t> values;
+    for (const auto & modulus : moduli) {
+        error::division_by_zero::check(modulus);
+        values.push_back(modulus);
+    }
+
+    if (values.empty()) { return values; }
+
+    return remainder_tree_(num, product_tree_(std::move(values)));
+}
+
+template <std::ranges::forward_range range_type>
+    requires TMP::instance_of<std::ranges::range_value_t<range_type>, basic_N>
+constexpr auto calc::batch_gcd(const range_type & values)
+    -> std::vector<std::ranges::range_value_t<range_type>> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // ALGORITHM: Batch GCD over the product tree (Bernstein)
+    // For every node c of the product tree, let R(c) be the product of all values that
+    // are not below c, reduced modulo c. Going down from R(root) = 1, with p the parent
+    // and s the sibling of c (c divides p, so R(p) mod c is what is left of R(p)):
+    //     R(c) = (R(p) mod c) × (s mod c) mod c
+    // At the leaves, GCD(v_i, R(v_i)) is the GCD of v_i with the product of all others.
+    // Compared with reducing the product modulo the squared nodes, every division has a
+    // divisor of the size of a node instead of its square, and no node is squared.
+
+    using basic_N_t = std::ranges::range_value_t<range_type>;
+
+    std::vector<basic_N_t> result;
+    for (const auto & value : values) {
+        error::division_by_zero::check(value);
+        result.push_back(value);
+    }
+
+    if (result.empty()) { return result; }
+
+    const std::vector<std::vector<basic_N_t>> tree = product_tree_(result);
+
+    // x mod m, without a division if x is already smaller
+    const auto reduce = [](basic_N_t & x, const basic_N_t & m) {
+        if (basic_N_t::detail::opr_comp(x, m) >= 0) { x = basic_N_t::detail::opr_div(x, m).second; }
+    };
+
+    std::vector<basic_N_t> cofactors{basic_N_t::one_};
+    reduce(cofactors.front(), tree.back().front());
+
+    for (std::size_t level = tree.size() - 1U; level-- > 0U;) {
+        const std::vector<basic_N_t> & nodes = tree[level];
+
+        std::vector<basic_N_t> below;
+        below.reserve(nodes.size());
+        for (std::size_t i = 0U; i < nodes.size(); ++i) {
+            basic_N_t & cofactor = below.emplace_back(cofactors[i / 2U]);
+
+            // the last node of an odd level is carried up unchanged and has no sibling
+            const std::size_t sibling = i ^ 1U;
+            if (sibling == nodes.size()) { continue; }
+
+            basic_N_t sibling_residue = nodes[sibling];
+            reduce(sibling_residue, nodes[i]);
+            reduce(cofactor, nodes[i]);
+            cofactor.opr_mult_assign_(sibling_residue);
+            reduce(cofactor, nodes[i]);
+        }
+
+        cofactors = std::move(below);
+    }
+
+    for (std::size_t i = 0U; i < result.size(); ++i) {
+        result[i] = gcd(std::move(result[i]), std::move(cofactors[i]));
+    }
+
+    return result;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::sqrt(basic_N_type && num)
+    -> std::pair<std::decay_t<basic_N_type>, std::decay_t<basic_N_type>> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // ALGORITHM: Integer square root by Newton's iteration (see sqrt_rem_)
+    // Returns (sqrt, remainder) where num = sqrt² + remainder
+
+    using basic_N_t = std::decay_t<basic_N_type>;
+
+    if (num.is_zero() || num.is_one()) { return {std::forward<decltype(num)>(num), basic_N_t{}}; }
+
+    return sqrt_rem_(num);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::sqrt_whole(basic_N_type && num) -> std::decay_t<basic_N_type> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // ALGORITHM: Integer square root (without remainder)
+    // Same as sqrt() but only returns the integer part, not the remainder.
+
+    if (num.is_zero() || num.is_one()) { return std::forward<decltype(num)>(num); }
+
+    return sqrt_rem_(num).first;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::root(basic_N_type && num, bitcount_t k)
+    -> std::pair<std::decay_t<basic_N_type>, std::decay_t<basic_N_type>> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // ALGORITHM: Integer k-th root by Newton's iteration
+    //     x = ((k - 1)·x + floor(num / x^(k-1))) / k
+    // From any x above the root, every step decreases x until it reaches the floor of
+    // the root. The iteration starts just above the floating-point estimate, with 50
+    // correct bits, so it needs about log2(bits of the root / 50) plus two steps. It must
+    // not start below the root: for large k, a step from x = r·(1 - ε) lands near
+    // r·e^(kε) and the way back down shrinks x by only a factor (1 - 1/k) per step.
+
+    using basic_N_t = std::decay_t<basic_N_type>;
+
+    error::division_by_zero::check(k);
+
+    if (k == 1U || num.is_zero() || num.is_one()) {
+        return {std::forward<decltype(num)>(num), basic_N_t{}};
+    }
+
+    if (k == 2U) { return sqrt_rem_(num); }
+
+    // 2^k > num, so the root is 1
+    if (k >= num.bits()) {
+        return {basic_N_t::one_, basic_N_t::detail::opr_subtr(num, basic_N_t::one_)};
+    }
+
+    const basic_N_t k_num{k};
+    const basic_N_t k_minus_one{k - 1U};
+
+    const auto newton_step = [&](const basic_N_t & x) {
+        basic_N_t next = basic_N_t::detail::opr_mult(x, k_minus_one);
+        next.opr_add_assign_(basic_N_t::detail::opr_div(num, pow(x, k_minus_one)).first);
+        return basic_N_t::detail::opr_div(next, k_num).first;
+    };
+
+    basic_N_t x = root_estimate_(num, k);
+    x.opr_add_assign_(x >> 40U);
+    x.opr_incr_();
+
+    // the estimate is off by far less than 2^-40, this is just a safeguard
+    while (basic_N_t::detail::opr_comp(pow(x, k_num), num) <= 0) { x.opr_bitshift_l_assign_(1U); }
+
+    for (basic_N_t next = newton_step(x); basic_N_t::detail::opr_comp(next, x) < 0;
+         next = newton_step(x)) {
+        x = std::move(next);
+    }
+
+    basic_N_t remainder = basic_N_t::detail::opr_subtr(num, pow(x, k_num));
+
+    return {std::move(x), std::move(remainder)};
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr bool calc::is_square(const basic_N_type & num) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // ALGORITHM: Quadratic residue filters
+    // A square is a quadratic residue modulo every m. Only 12 of the 64 residues modulo
+    // 64 are squares, 16/63, 21/65 and 6/11 for the others, so together they let through
+    // about 0.6% of the non-squares. 63 × 65 × 11 = 45045 needs one pass over the limbs.
+
+    if (num.is_zero()) { return true; }
+
+    constexpr auto residues = [](std::uint32_t m) {
+        std::array<bool, 65U> is_residue{};
+        for (std::uint32_t i = 0U; i < m; ++i) { is_residue[i * i % m] = true; }
+        return is_residue;
+    };
+
+    constexpr auto squares_64 = residues(64U);
+    constexpr auto squares_63 = residues(63U);
+    constexpr auto squares_65 = residues(65U);
+    constexpr auto squares_11 = residues(11U);
+
+    if (!squares_64[num.digits_.front() & 63U]) { return false; }
+
+    const std::uint32_t r = residue_(num, 63U * 65U * 11U);
+
+    if (!squares_63[r % 63U] || !squares_65[r % 65U] || !squares_11[r % 11U]) { return false; }
+
+    return sqrt_rem_(num).second.is_zero();
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr bool calc::is_perfect_power(const basic_N_type & num) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // ALGORITHM: Root extraction for prime exponents
+    // num = a^b with b ≥ 2 if and only if num = c^p for a prime p dividing b, and
+    // num ≥ 2^p, so only primes p < num.bits() need to be tried:
+    // 1. p = 2 is is_square()
+    // 2. With v trailing zero bits (v > 0), p must divide v
+    // 3. For a prime q ≡ 1 (mod p), the p-th powers modulo q are 0 and the x with
+    //    x^((q-1)/p) ≡ 1, a fraction of about 1/p. Two such q < 2^32 reject most non-powers
+    //    with two residues of num
+    // 4. Otherwise root(num, p) decides
+
+    if (num.bits() <= 1U || is_square(num)) { return true; }
+
+    const bitcount_t bits = num.bits();
+    const bitcount_t trailing_zeroes = num.ctz();
+
+    constexpr auto is_small_prime = [](std::uint64_t n) {
+        if (n < 2U) { return false; }
+        for (std::uint64_t d = 2U; d * d <= n; ++d) {
+            if (n % d == 0U) { return false; }
+        }
+        return true;
+    };
+
+    // num mod q is a p-th power residue
+    const auto is_power_residue = [&num](std::uint64_t p, std::uint32_t q) {
+        std::uint64_t base = residue_(num, q);
+        if (base == 0U) { return true; }
+
+        std::uint64_t result = 1U;
+        for (std::uint64_t e = (q - 1U) / p; e != 0U; e >>= 1U) {
+            if ((e & 1U) != 0U) { result = result * base % q; }
+            base = base * base % q;
+        }
+        return result == 1U;
+    };
+
+    constexpr std::uint64_t max_filter = std::numeric_limits<std::uint32_t>::max();
+
+    for (bitcount_t p = 3U; p < bits; p += 2U) {
+        if (!is_small_prime(p)) { continue; }
+        if (trailing_zeroes != 0U && trailing_zeroes % p != 0U) { continue; }
+
+        bool rejected = false;
+        unsigned filters = 0U;
+        for (std::uint64_t q = 2U * p + 1U; q <= max_filter && filters < 2U; q += 2U * p) {
+            if (!is_small_prime(q)) { continue; }
+            ++filters;
+            if (!is_power_residue(p, static_cast<std::uint32_t>(q))) {
+                rejected = true;
+                break;
+            }
+        }
+
+        if (!rejected && root(num, p).second.is_zero()) { return true; }
+    }
+
+    return false;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::ilog(const basic_N_type & num, const basic_N_type & base) -> bitcount_t {
+    JMATHS_FUNCTION_TO_LOG;
+
+    assert(!num.is_zero());
+    assert(!base.is_zero() && !base.is_one());
+
+    return num.ilog_(base);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::ilog2(const basic_N_type & num) -> bitcount_t {
+    JMATHS_FUNCTION_TO_LOG;
+
+    assert(!num.is_zero());
+
+    return num.bits() - 1U;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::ilog10(const basic_N_type & num) -> bitcount_t {
+    JMATHS_FUNCTION_TO_LOG;
+
+    assert(!num.is_zero());
+
+    return num.ilog_(basic_N_type{10U});
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr bool calc::is_probable_prime(const basic_N_type & num, unsigned extra_rounds) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // ALGORITHM: Baillie-PSW
+    // 1. Trial division by the primes below 1024 decides small numbers and removes about
+    //    92% of random odd candidates with a few passes over the limbs
+    // 2. Strong probable prime test to base 2 (Miller-Rabin)
+    // 3. Strong Lucas probable prime test with Selfridge's parameters
+    // No composite is known to pass both 2 and 3, and the two tests fail on different
+    // kinds of pseudoprimes. Every modular product of 2, 3 and the extra Miller-Rabin
+    // rounds goes through one Montgomery context.
+
+    if (const auto decided = trial_division_(num)) { return *decided; }
+
+    const montgomery_context<basic_N_type> ctx{num};
+
+    if (!strong_probable_prime_(ctx, basic_N_type{2U})) { return false; }
+
+    // the Lucas test needs a D with (D / num) = -1, which a square does not have
+    if (is_square(num) || !strong_lucas_probable_prime_(ctx)) { return false; }
+
+    // random bases in [2, num - 2]
+    const basic_N_type range = basic_N_type::detail::opr_subtr(num, basic_N_type{3U});
+    for (unsigned round = 0U; round < extra_rounds; ++round) {
+        basic_N_type base =
+            basic_N_type::detail::opr_div(rand<basic_N_type>::generate(num.bits() + 64U), range)
+                .second;
+        base.opr_add_assign_(basic_N_type{2U});
+
+        if (!strong_probable_prime_(ctx, base)) { return false; }
+    }
+
+    return true;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::next_prime(const basic_N_type & num, bool safe) -> basic_N_type {
+    JMATHS_FUNCTION_TO_LOG;
+
+    basic_N_type candidate = num;
+    candidate.opr_incr_();
+
+    // small numbers are decided by trial division, and the sieve would remove the small
+    // primes themselves
+    for (; candidate.bits() <= 20U; candidate.opr_incr_()) {
+        if (is_probable_prime(candidate) &&
+            (!safe || (candidate.is_odd() && is_probable_prime(candidate >> 1U)))) {
+            return candidate;
+        }
+    }
+
+    return *sieve_prime_(std::move(candidate), std::numeric_limits<bitcount_t>::max(), safe);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::random_prime(bitcount_t bits, bool safe) -> basic_N_type {
+    JMATHS_FUNCTION_TO_LOG;
+
+    assert(bits >= (safe ? 3U : 2U));
+
+    const basic_N_type top = basic_N_type::one_ << (bits - 1U);
+
+    for (;;) {
+        // uniform in [2^(bits-1), 2^bits), then the first prime from there
+        basic_N_type start = rand<basic_N_type>::generate(bits - 1U);
+        start.opr_add_assign_(top);
+
+        if (bits <= 20U) {
+            start.opr_decr_();
+            basic_N_type prime = next_prime(start, safe);
+            if (prime.bits() == bits) { return prime; }
+        } else if (auto prime = sieve_prime_(std::move(start), bits, safe)) {
+            return *std::move(prime);
+        }
+    }
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::factorial(std::uint64_t n) -> basic_N_type {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // ALGORITHM: Prime swing (Luschny)
+    // With swing(n) = n! / (⌊n/2⌋!)², which is the product of p^e over the primes p ≤ n
+    // with e the number of odd ⌊n/p^i⌋ (and p^e ≤ n),
+    //     n! = (⌊n/2⌋!)² × swing(n)
+    // Going up from a small factorial, every halving of n costs one squaring and one
+    // product of about the same length, instead of n multiplications by small numbers.
+
+    assert(n < std::numeric_limits<std::uint32_t>::max());
+
+    // 20! is the largest factorial below 2^64
+    constexpr std::uint64_t native_bound = 21U;
+
+    std::vector<std::uint64_t> levels;
+    for (std::uint64_t m = n; m >= native_bound; m /= 2U) { levels.push_back(m); }
+
+    std::uint64_t small = 1U;
+    for (std::uint64_t i = 2U; i <= (levels.empty() ? n : levels.back() / 2U); ++i) { small *= i; }
+
+    basic_N_type result{small};
+
+    if (levels.empty()) { return result; }
+
+    const std::vector<std::uint32_t> primes = primes_below_(static_cast<std::uint32_t>(n) + 1U);
+
+    for (std::size_t i = levels.size(); i-- > 0U;) {
+        const auto level = levels[i];
+        // primes up to level
+        const auto count = static_cast<std::size_t>(
+            std::ranges::upper_bound(primes, level) - primes.begin());
+
+        result.opr_mult_assign_(result);
+        result.opr_mult_assign_(prime_swing_<basic_N_type>(level, std::span{primes}.first(count)));
+    }
+
+    return result;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::multifactorial(std::uint64_t n, std::uint64_t m) -> basic_N_type {
+    JMATHS_FUNCTION_TO_LOG;
+
+    assert(m != 0U);
+
+    if (m == 1U) { return factorial<basic_N_type>(n); }
+
+    // (2k)!! = 2^k × k!
+    if (m == 2U && n % 2U == 0U) {
+        basic_N_type result = factorial<basic_N_type>(n / 2U);
+        result.opr_bitshift_l_assign_(n / 2U);
+        return result;
+    }
+
+    std::vector<std::uint64_t> factors;
+    factors.reserve(n / m + 1U);
+    for (std::uint64_t factor = n; factor > 0U; factor -= std::min(factor, m)) {
+        factors.push_back(factor);
+    }
+
+    return product_native_<basic_N_type>(factors);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::double_factorial(std::uint64_t n) -> basic_N_type {
+    JMATHS_FUNCTION_TO_LOG;
+
+    return multifactorial<basic_N_type>(n, 2U);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::binomial(std::uint64_t n, std::uint64_t k) -> basic_N_type {
+    JMATHS_FUNCTION_TO_LOG;
+
+    if (k > n) { return basic_N_type{}; }
+
+    k = std::min(k, n - k);
+
+    if (k == 0U) { return basic_N_type::one_; }
+
+    // below this, the primes up to n are cheap to sieve; k! for a larger k would be no
+    // cheaper than the sieve, and the result has at least 2^k bits anyway
+    constexpr std::uint64_t sieve_bound = std::uint64_t{1U} << 26U;
+
+    if (n < sieve_bound || k >= sieve_bound) {
+        assert(n < std::numeric_limits<std::uint32_t>::max());
+
+        // ALGORITHM: Kummer's theorem
+        // The exponent of p in the binomial coefficient is the number of i with
+        //     ⌊n/p^i⌋ - ⌊k/p^i⌋ - ⌊(n-k)/p^i⌋ = 1
+        // (a borrow in digit i - 1 of n - k in base p), and p^e ≤ n.
+
+        const std::vector<std::uint32_t> primes =
+            primes_below_(static_cast<std::uint32_t>(n) + 1U);
+
+        std::vector<std::uint64_t> factors;
+        for (const std::uint64_t p : primes) {
+            std::uint64_t power = 1U;
+            for (std::uint64_t a = n / p, b = k / p, c = (n - k) / p; a > 0U;
+                 a /= p, b /= p, c /= p) {
+                if (a - b - c != 0U) { power *= p; }
+            }
+
+            if (power != 1U) { factors.push_back(power); }
+        }
+
+        return product_native_<basic_N_type>(factors);
+    }
+
+    // n - k + 1, ..., n divided by k!, for large n and small k (k < 2^26)
+    std::vector<std::uint64_t> factors;
+    factors.reserve(k);
+    for (std::uint64_t i = 0U; i < k; ++i) { factors.push_back(n - i); }
+
+    return basic_N_type::detail::opr_div(product_native_<basic_N_type>(factors),
+                                         factorial<basic_N_type>(k))
+        .first;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type_1, TMP::decays_to<basic_N_type_1> basic_N_type_2>
+constexpr auto calc::pow(basic_N_type_1 && base, basic_N_type_2 && exponent)
+    -> std::decay_t<basic_N_type_1> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // ALGORITHM: Sliding-window exponentiation (see sliding_window.hpp)
+    // The exponent is scanned from the most significant bit, so every multiplication
+    // is by one of the small precomputed odd powers base^1, base^3, ... instead of by
+    // an ever larger power of the base as in right-to-left binary exponentiation.
+    // For example, 3^13 = 3^(1101₂) with 2-bit windows is ((3^3)^2)^2 × 3.
+    //
+    // Time complexity: O(log exponent) multiplications instead of O(exponent)
+    // This makes huge exponents feasible (e.g., 2^1000000)
+
+    using basic_N_t = std::decay_t<basic_N_type_1>;
+
+    return internal::sliding_window_pow<basic_N_t>(
+        base,
+        exponent,
+        basic_N_t::one_,
+        [](basic_N_t & x) { x.opr_mult_assign_(x); },
+        [](basic_N_t & x, const basic_N_t & y) { x.opr_mult_assign_(y); });
+}
+
+template <TMP::instance_of<basic_N> basic_N_type_1, TMP::decays_to<basic_N_type_1> basic_N_type_2>
+constexpr auto calc::pow_mod(basic_N_type_1 && base,
+                             basic_N_type_2 && exponent,
+                             const std::decay_t<basic_N_type_1> & mod)
+    -> std::decay_t<basic_N_type_1> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // ALGORITHM: Sliding-window modular exponentiation
+    // Computes (base^exponent) mod mod efficiently.
+    // This is crucial for cryptographic applications (e.g., RSA encryption).
+    //
+    // Every square and product is reduced right away, which is based on the property
+    // (a * b) mod m = ((a mod m) * (b mod m)) mod m, so intermediate values never
+    // exceed mod². The base is reduced once up front, and the exponent is processed in
+    // windows of up to 7 bits (see sliding_window.hpp).
+    //
+    // Time complexity: O(log exponent) multiplications and reductions
+
+    using basic_N_t = std::decay_t<basic_N_type_1>;
+
+    error::division_by_zero::check(mod);
+
+    // x^0 = 1, which is 0 modulo 1
+    if (exponent.is_zero()) { return mod.is_one() ? basic_N_t{} : basic_N_t::one_; }
+
+    // odd moduli: Montgomery multiplication replaces every division by two
+    // multiply-and-shift passes; even moduli: Barrett reduction replaces it by two
+    // multiplications
+    if (mod.is_odd()) { return montgomery_context<basic_N_t>{mod}.pow(base, exponent); }
+    return barrett_context<basic_N_t>{mod}.pow(base, exponent);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type_1, TMP::decays_to<basic_N_type_1> basic_N_type_2>
+constexpr auto calc::pow_mod_ct(basic_N_type_1 && base,
+                                basic_N_type_2 && exponent,
+                                const std::decay_t<basic_N_type_1> & mod)
+    -> std::decay_t<basic_N_type_1> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // no shortcut for a zero exponent here: the exponent is secret
+    return montgomery_context<std::decay_t<basic_N_type_1>>{mod}.pow_ct(base, exponent);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::multi_pow_mod(std::span<const std::type_identity_t<basic_N_type>> bases,
+                                   std::span<const std::type_identity_t<basic_N_type>> exponents,
+                                   const basic_N_type & mod) -> basic_N_type {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // ALGORITHM: Multi-exponentiation
+    // Separate powers would each need their own chain of squarings; here all terms are
+    // merged into one chain (see multi_pow.hpp). The bases are brought into the
+    // representation of the reduction context once, like in pow_mod(). Modulo an odd
+    // number the chain runs on limb arrays of fixed length through the Montgomery product
+    // that does not allocate, as in montgomery_context::pow().
+
+    assert(bases.size() == exponents.size());
+
+    error::division_by_zero::check(mod);
+
+    if (mod.is_odd()) {
+        using limb_vector = decltype(basic_N_type::digits_);
+
+        const montgomery_context<basic_N_type> ctx{mod};
+        const std::size_t n = ctx.limbs();
+
+        const auto load = [n](const basic_N_type & x) {
+            limb_vector limbs = x.digits_;
+            limbs.resize(n);
+            return limbs;
+        };
+
+        std::vector<limb_vector> converted;
+        converted.reserve(bases.size());
+        for (const auto & base : bases) { converted.push_back(load(ctx.to_montgomery(base))); }
+
+        limb_vector scratch(n);
+
+        basic_N_type result;
+        result.digits_ = internal::multi_pow(
+            std::span<const limb_vector>(converted),
+            exponents,
+            load(ctx.to_montgomery(basic_N_type::one_)),
+            [&](limb_vector & x) {
+                ctx.mul(scratch, x, x);
+                x.swap(scratch);
+            },
+            [&](limb_vector & x, const limb_vector & y) {
+                ctx.mul(scratch, x, y);
+                x.swap(scratch);
+            });
+        result.remove_leading_zeroes_();
+
+        return ctx.from_montgomery(result);
+    }
+
+    std::vector<basic_N_type> converted;
+    converted.reserve(bases.size());
+
+    const barrett_context<basic_N_type> ctx{mod};
+
+    for (const auto & base : bases) { converted.push_back(ctx.reduce(base)); }
+
+    return internal::multi_pow(
+        std::span<const basic_N_type>(converted),
+        exponents,
+        ctx.reduce(basic_N_type::one_),
+        [&ctx](basic_N_type & x) { x = ctx.mul(x, x); },
+        [&ctx](basic_N_type & x, const basic_N_type & y) { x = ctx.mul(x, y); });
+}
+
+template <TMP::instance_of<basic_Z> basic_Z_type, TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::pow(basic_Z_type && base, basic_N_type && exponent)
+    -> std::decay_t<basic_Z_type> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    const auto sign =
+        base.is_negative() && exponent.is_odd() ? sign_type::negative : sign_type::positive;
+
+    return {
+        pow(std::forward<decltype(base)>(base).abs(), std::forward<decltype(exponent)>(exponent)),
+        sign};
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::leading_bits_(const basic_N_type & num, bitcount_t shift)
+    -> typename basic_N_type::base_int_big_type {
+    JMATHS_FUNCTION_TO_LOG;
+
+    using base_int_big_t = typename basic_N_type::base_int_big_type;
+
+    static constexpr bitcount_t digit_bits = basic_N_type::base_int_type_bits;
+
+    const auto digit = [&num](std::size_t i) -> base_int_big_t {
+        return i < num.digits_.size() ? num.digits_[i] : 0U;
+    };
+
+    const auto first = static_cast<std::size_t>(shift / digit_bits);
+    const bitcount_t offset = shift % digit_bits;
+
+    // the window spans at most three digits
+    auto window = static_cast<base_int_big_t>((digit(first + 1U) << digit_bits) | digit(first));
+    window = static_cast<base_int_big_t>(window >> offset);
+
+    if (offset != 0U) {
+        window = static_cast<base_int_big_t>(window |
+                                             (digit(first + 2U) << (2U * digit_bits - offset)));
+    }
+
+    return static_cast<base_int_big_t>(
+        window & ((base_int_big_t{1} << lehmer_bits_<basic_N_type>) - 1U));
+}
+
+template <TMP::instance_of<basic_N> basic_N_type, std::signed_integral cofactor_type>
+constexpr void calc::apply_cofactors_(basic_N_type & out,
+                                      const basic_N_type & x,
+                                      cofactor_type p,
+                                      const basic_N_type & y,
+                                      cofactor_type q,
+                                      basic_N_type & factor) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    using base_int_big_t = typename basic_N_type::base_int_big_type;
+
+    // the cofactors have opposite signs (or one of them is zero), so the result is the
+    // product with the non-negative cofactor minus the other product
+    const bool p_first = q <= 0;
+
+    out.set_zero();
+
+    factor = static_cast<base_int_big_t>(p_first ? p : q);
+    out.opr_addmul_assign_(p_first ? x : y, factor);
+
+    factor = static_cast<base_int_big_t>(p_first ? -q : -p);
+    out.opr_submul_assign_(p_first ? y : x, factor);
+}
+
+template <std::signed_integral cofactor_type>
+constexpr auto calc::lehmer_matrix_(cofactor_type x_hat, cofactor_type y_hat)
+    -> std::array<cofactor_type, 4U> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    cofactor_type A = 1, B = 0, C = 0, D = 1;
 
-    // Main loop: both numbers are now odd
     for (;;) {
-        assert(num1.is_odd());
-        assert(num2.is_odd());
+        if (y_hat + C == 0 || y_hat + D == 0) { break; }
+
+        assert(x_hat + A >= 0 && y_hat + C > 0);
+
+        const auto q = static_cast<cofactor_type>((x_hat + A) / (y_hat + C));
+
+        if (q != (x_hat + B) / (y_hat + D)) { break; }
+
+        auto temp = static_cast<cofactor_type>(A - q * C);
+        A = C;
+        C = temp;
+
+        temp = static_cast<cofactor_type>(B - q * D);
+        B = D;
+        D = temp;
+
+        temp = static_cast<cofactor_type>(x_hat - q * y_hat);
+        x_hat = y_hat;
+        y_hat = temp;
+    }
+
+    return {A, B, C, D};
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::gcdext_(basic_N_type x, basic_N_type y)
+    -> std::pair<basic_N_type, typename basic_N_type::basic_Z_type> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // Same steps as gcd(), but with the invariants x ≡ s0 × x_0 and y ≡ s1 × x_0
+    // (mod y_0). A cofactor matrix updates s0 and s1 like x and y, a division step
+    // with quotient q sets s0, s1 = s1, s0 - q × s1.
+    // The loop runs Lehmer steps down to the end so that no cofactors are lost to a
+    // native finish.
+
+    using basic_Z_t = typename basic_N_type::basic_Z_type;
+    using base_int_big_t = typename basic_N_type::base_int_big_type;
+    using cofactor_t = std::make_signed_t<base_int_big_t>;
+
+    const auto to_Z = [](cofactor_t c) -> basic_Z_t {
+        return {basic_N_type{static_cast<base_int_big_t>(c < 0 ? -c : c)},
+                c < 0 ? sign_type::negative : sign_type::positive};
+    };
+
+    basic_Z_t s0 = 1;
+    basic_Z_t s1 = 0;
+
+    if (basic_N_type::detail::opr_comp(x, y) < 0) {
+        x.digits_.swap(y.digits_);
+        std::swap(s0, s1);
+    }
+
+    if (x.is_zero()) { s0.set_zero(); }
+
+    basic_N_type next_x;
+    basic_N_type next_y;
+    basic_N_type factor;
+    basic_Z_t next_s0;
+    basic_Z_t next_s1;
+
+    while (!y.is_zero()) {
+        if (x.bits() > lehmer_bits_<basic_N_type>) {
+            const bitcount_t shift = x.bits() - lehmer_bits_<basic_N_type>;
+
+            const auto [A, B, C, D] =
+                lehmer_matrix_(static_cast<cofactor_t>(leading_bits_(x, shift)),
+                               static_cast<cofactor_t>(leading_bits_(y, shift)));
+
+            if (B != 0) {
+                apply_cofactors_(next_x, x, A, y, B, factor);
+                apply_cofactors_(next_y, x, C, y, D, factor);
+                x.digits_.swap(next_x.digits_);
+                y.digits_.swap(next_y.digits_);
+
+                next_s0.set_zero();
+                next_s0.opr_addmul_assign_(s0, to_Z(A), false);
+                next_s0.opr_addmul_assign_(s1, to_Z(B), false);
+                next_s1.set_zero();
+                next_s1.opr_addmul_assign_(s0, to_Z(C), false);
+                next_s1.opr_addmul_assign_(s1, to_Z(D), false);
+                std::swap(s0, next_s0);
+                std::swap(s1, next_s1);
+                continue;
+            }
+        }
+
+        // x, y = y, x mod y
+        auto [q, r] = basic_N_type::detail::opr_div(x, y);
+        x.digits_.swap(y.digits_);
+        y.digits_.swap(r.digits_);
+
+        s0.opr_addmul_assign_(s1, basic_Z_t{std::move(q)}, true);
+        std::swap(s0, s1);
+    }
+
+    return {std::move(x), std::move(s0)};
+}
 
-        // Ensure num1 <= num2 (swap if necessary)
-        if (basic_N_t::detail::opr_comp(num1, num2) > 0) { num1.digits_.swap(num2.digits_); }
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::sqrt_rem_(const basic_N_type & num) -> std::pair<basic_N_type, basic_N_type> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // ALGORITHM: Newton's iteration with doubling precision
+    // With c = floor((bits - 1) / 2) and n_d = num >> 2(c - d), the leading 2d + 2 bits of
+    // num, a holds a root of n_d that is off by less than 1. Going from d_old to
+    // d = 2·d_old or 2·d_old + 1 bits, one Newton step
+    //     a = (a << (d - d_old - 1)) + (num >> (2c - d_old - d + 1)) / a
+    // keeps that property, because the error of Newton's method squares at every step.
+    // The first root comes from the floating-point square root of the leading 54 bits,
+    // every step costs one division of twice the size of the previous one, so the whole
+    // root costs about as much as a few divisions of num by its root. At the end a is
+    // either the root or one too large.
+
+    assert(!num.is_zero());
+
+    constexpr bitcount_t native_bits = 26U;  // n_d < 2^54 is exact in a double
+
+    const bitcount_t c = (num.bits() - 1U) / 2U;
+
+    unsigned shift = 0U;
+    while ((c >> shift) > native_bits) { ++shift; }
+
+    bitcount_t d = c >> shift;
+    basic_N_type root{sqrt_native_(*(num >> 2U * (c - d)).template fits_into<std::uint64_t>())};
 
-        // Subtract: num2 = num2 - num1 (difference is even since both are odd)
-        num2.opr_subtr_assign_(num1);
+    while (shift-- > 0U) {
+        const bitcount_t e = d;
+        d = c >> shift;
 
-        if (num2.is_zero()) { return num1.opr_bitshift_l_(k); }
+        basic_N_type quotient =
+            basic_N_type::detail::opr_div(num >> (2U * c - e - d + 1U), root).first;
+        root.opr_bitshift_l_assign_(d - e - 1U);
+        root.opr_add_assign_(quotient);
+    }
+
+    basic_N_type square = basic_N_type::detail::opr_mult(root, root);
 
-        // Remove all factors of 2 from num2 (make it odd again)
-        num2.opr_bitshift_r_assign_(num2.ctz());
+    if (basic_N_type::detail::opr_comp(square, num) > 0) {
+        // (a - 1)² = a² - 2a + 1
+        root.opr_decr_();
+        square.opr_subtr_assign_(root);
+        square.opr_subtr_assign_(root);
+        square.opr_decr_();
     }
+
+    return {std::move(root), basic_N_type::detail::opr_subtr(num, square)};
 }
 
 template <TMP::instance_of<basic_N> basic_N_type>
-constexpr auto calc::sqrt(basic_N_type && num)
-    -> std::pair<std::decay_t<basic_N_type>, std::decay_t<basic_N_type>> {
+constexpr auto calc::root_estimate_(const basic_N_type & num, bitcount_t k) -> basic_N_type {
     JMATHS_FUNCTION_TO_LOG;
 
-    // ALGORITHM: Integer square root using binary search
-    // Finds the largest integer x such that x² ≤ num, plus the remainder.
-    // Returns (sqrt, remainder) where num = sqrt² + remainder
-    //
-    // The algorithm uses binary search in the range [1, num/2]:
-    // 1. If num is 0 or 1, return it directly
-    // 2. Set search range: start = 1, end = num/2
-    // 3. Binary search:
-    //    - Calculate mid = (start + end) / 2
-    //    - If mid² = num: return (mid, 0)
-    //    - If mid² < num: move start up, remember this as potential answer
-    //    - If mid² > num: move end down
-    // 4. Calculate remainder = num - answer²
-    //
-    // Time complexity: O(log n) iterations, each with O(n²) multiplication
+    const bitcount_t bits = num.bits();
 
-    using basic_N_t = std::decay_t<basic_N_type>;
+    // 2^ceil(bits / k) is above the root, but as much as twice the root, so this is only
+    // used where floating point is not available
+    if consteval { return basic_N_type::one_ << (bits + k - 1U) / k; }
 
-    if (num.is_zero() || num.is_one()) { return {std::forward<decltype(num)>(num), basic_N_t{}}; }
+    // log2(num) from the leading 64 bits, divided by k and split into an integer part
+    // and a mantissa of 52 bits
+    const bitcount_t shift = bits > 64U ? bits - 64U : 0U;
+    const auto top = *(num >> shift).template fits_into<std::uint64_t>();
+
+    const double log_root =
+        (static_cast<double>(shift) + std::log2(static_cast<double>(top))) / static_cast<double>(k);
+    const auto exponent = static_cast<bitcount_t>(log_root);
+    const auto mantissa = static_cast<std::uint64_t>(
+        std::ldexp(std::exp2(log_root - static_cast<double>(exponent)), 52));
+
+    basic_N_type estimate{mantissa};
+    if (exponent >= 52U) {
+        estimate.opr_bitshift_l_assign_(exponent - 52U);
+    } else {
+        estimate.opr_bitshift_r_assign_(52U - exponent);
+    }
+
+    if (estimate.is_zero()) { return basic_N_type::one_; }
+
+    return estimate;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr std::uint32_t calc::residue_(const basic_N_type & num, std::uint32_t divisor) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    assert(divisor != 0U);
+
+    // Horner's scheme with radix mod divisor, which keeps every intermediate value below
+    // 2^64 for any limb width
+    const std::uint64_t radix_residue =
+        (static_cast<std::uint64_t>(basic_N_type::max_digit % divisor) + 1U) % divisor;
+
+    std::uint64_t remainder = 0U;
+    for (std::size_t i = num.digits_.size(); i-- > 0U;) {
+        remainder = (remainder * radix_residue + num.digits_[i] % divisor) % divisor;
+    }
+
+    return static_cast<std::uint32_t>(remainder);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::residues_(const basic_N_type & num, std::span<const std::uint32_t> primes)
+    -> std::vector<std::uint32_t> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    std::vector<std::uint32_t> residues(primes.size());
+
+    for (std::size_t first = 0U; first < primes.size();) {
+        std::size_t last = first;
+        std::uint64_t product = 1U;
+        while (last < primes.size() &&
+               product * primes[last] <= std::numeric_limits<std::uint32_t>::max()) {
+            product *= primes[last++];
+        }
+
+        const std::uint32_t r = residue_(num, static_cast<std::uint32_t>(product));
+        for (std::size_t i = first; i < last; ++i) { residues[i] = r % primes[i]; }
 
-    basic_N_t start = basic_N_t::one_, end = num.opr_bitshift_r_(1U), ans;
+        first = last;
+    }
+
+    return residues;
+}
 
-    while (basic_N_t::detail::opr_comp(start, end) <= 0) {
-        basic_N_t mid = basic_N_t::detail::opr_add(start, end);
-        mid.opr_bitshift_r_assign_(1U);
+template <typename T, TMP::instance_of<basic_N> basic_N_type, typename sqr_type, typename add_type,
+          typename sub_type>
+constexpr auto calc::fibonacci_doubling_(const basic_N_type & n,
+                                         const T & one,
+                                         const T & two,
+                                         sqr_type sqr,
+                                         add_type add,
+                                         sub_type sub) -> std::pair<T, T> {
+    JMATHS_FUNCTION_TO_LOG;
 
-        const basic_N_t sqr = basic_N_t::detail::opr_mult(mid, mid);
+    // ALGORITHM: Fast doubling from the top bit of n, keeping (F(k), F(k - 1))
+    // With a = F(k)² and b = F(k - 1)²,
+    //     F(2k + 1) = 4a - b + 2(-1)^k
+    //     F(2k - 1) = a + b
+    //     F(2k)     = F(2k + 1) - F(2k - 1)
+    // so every bit of n costs two squarings, and the bit picks (F(2k + 1), F(2k)) or
+    // (F(2k), F(2k - 1)). 4a - b - 2 is never negative for k ≥ 1.
+
+    assert(!n.is_zero());
+
+    T current = one;  // F(1)
+    T previous{};     // F(0)
+    bool odd = true;  // k = 1
+
+    for (bitcount_t i = n.bits() - 1U; i-- > 0U;) {
+        T square = current;
+        sqr(square);
+        sqr(previous);
+
+        T next = square;
+        add(next, next);
+        add(next, next);
+        sub(next, previous);
+        if (odd) {
+            sub(next, two);
+        } else {
+            add(next, two);
+        }
 
-        const auto compared = basic_N_t::detail::opr_comp(sqr, num);
+        add(previous, square);  // F(2k - 1)
 
-        if (compared == 0) { return {std::move(mid), basic_N_t{}}; }
+        T even = next;
+        sub(even, previous);  // F(2k)
 
-        if (compared < 0) {
-            // mid² < num: this could be our answer, but try larger values
-            ans = mid;
-            mid.opr_incr_();
-            start = std::move(mid);
+        odd = n[i];
+        if (odd) {
+            current = std::move(next);
+            previous = std::move(even);
         } else {
-            // mid² > num: try smaller values
-            mid.opr_decr_();
-            end = std::move(mid);
+            current = std::move(even);
         }
     }
 
-    basic_N_t remainder = basic_N_t::detail::opr_subtr(num, basic_N_t::detail::opr_mult(ans, ans));
+    return {std::move(current), std::move(previous)};
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::fibonacci_previous_(std::uint64_t n) -> std::pair<basic_N_type, basic_N_type> {
+    JMATHS_FUNCTION_TO_LOG;
 
-    return {std::move(ans), std::move(remainder)};
+    return fibonacci_doubling_(
+        basic_N_type{n}, basic_N_type::one_, basic_N_type{2U},
+        [](basic_N_type & x) { x.opr_mult_assign_(x); },
+        [](basic_N_type & x, const basic_N_type & y) { x.opr_add_assign_(y); },
+        [](basic_N_type & x, const basic_N_type & y) { x.opr_subtr_assign_(y); });
 }
 
 template <TMP::instance_of<basic_N> basic_N_type>
-constexpr auto calc::sqrt_whole(basic_N_type && num) -> std::decay_t<basic_N_type> {
+constexpr auto calc::fibonacci_mod_(const basic_N_type & n, const basic_N_type & mod, bool lucas)
+    -> basic_N_type {
     JMATHS_FUNCTION_TO_LOG;
 
-    // ALGORITHM: Integer square root (without remainder)
-    // Same as sqrt() but only returns the integer part, not the remainder.
-    // Slightly optimized since we don't need to calculate the remainder.
+    error::division_by_zero::check(mod);
 
-    using basic_N_t = std::decay_t<basic_N_type>;
+    // the doubling on residues below mod, ctx is a montgomery_context or barrett_context
+    // and one is 1 in its representation
+    const auto run = [&](const auto & ctx, const basic_N_type & one) {
+        const auto add = [&mod](basic_N_type & x, const basic_N_type & y) {
+            x.opr_add_assign_(y);
+            if (basic_N_type::detail::opr_comp(x, mod) >= 0) { x.opr_subtr_assign_(mod); }
+        };
+        const auto sub = [&mod](basic_N_type & x, const basic_N_type & y) {
+            if (basic_N_type::detail::opr_comp(x, y) < 0) { x.opr_add_assign_(mod); }
+            x.opr_subtr_assign_(y);
+        };
+
+        basic_N_type two = one;
+        add(two, one);
+
+        if (n.is_zero()) { return lucas ? two : basic_N_type{}; }
+
+        auto [current, previous] = fibonacci_doubling_(
+            n, one, two, [&ctx](basic_N_type & x) { x = ctx.mul(x, x); }, add, sub);
+
+        // L(n) = F(n) + 2F(n - 1)
+        if (lucas) {
+            add(current, previous);
+            add(current, previous);
+        }
 
-    if (num.is_zero() || num.is_one()) { return std::forward<decltype(num)>(num); }
+        return current;
+    };
+
+    // odd moduli in Montgomery form, even moduli with Barrett reduction, as in pow_mod
+    if (mod.is_odd()) {
+        const montgomery_context<basic_N_type> ctx{mod};
+        return ctx.from_montgomery(run(ctx, ctx.to_montgomery(basic_N_type::one_)));
+    }
+
+    const barrett_context<basic_N_type> ctx{mod};
+    return run(ctx, ctx.reduce(basic_N_type::one_));
+}
+
+template <TMP::instance_of<basic_N> basic_N_type, typename term_type>
+constexpr auto calc::binary_splitting_(std::uint64_t first,
+                                       std::uint64_t last,
+                                       term_type & term,
+                                       bool need_p)
+    -> std::tuple<typename basic_N_type::basic_Z_type,
+                  basic_N_type,
+                  typename basic_N_type::basic_Z_type> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    using basic_Z_t = typename basic_N_type::basic_Z_type;
 
-    basic_N_t start = basic_N_t::one_, end = num.opr_bitshift_r_(1U), ans;
+    if (last - first == 1U) {
+        std::tuple<basic_Z_t, basic_N_type, basic_Z_t> leaf = term(first);
+        auto & [p, q, a] = leaf;
+        assert(!q.is_zero());
+        a *= p;
+        return leaf;
+    }
+
+    const std::uint64_t middle = first + (last - first) / 2U;
+    auto [p_left, q_left, t_left] = binary_splitting_<basic_N_type>(first, middle, term, true);
+    auto [p_right, q_right, t_right] =
+        binary_splitting_<basic_N_type>(middle, last, term, need_p);
+
+    // T = T₁Q₂ + P₁T₂
+    t_right *= p_left;
+    t_right.addmul(t_left, basic_Z_t{q_right});
+
+    q_left.opr_mult_assign_(q_right);
+
+    if (need_p) {
+        p_left *= p_right;
+    } else {
+        p_left.set_zero();
+    }
+
+    return {std::move(p_left), std::move(q_left), std::move(t_right)};
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::scaled_ratio_(basic_N_type num,
+                                   basic_N_type den,
+                                   const basic_N_type & factor) -> basic_N_type {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // T and Q of a series are much longer than the quotient needs: keeping 64 bits more of
+    // den than the quotient has moves the quotient by less than 2^-60
+    const bitcount_t keep =
+        factor.bits() + (num.bits() > den.bits() ? num.bits() - den.bits() : 0U) + 64U;
+    if (den.bits() > keep) {
+        const bitcount_t shift = den.bits() - keep;
+        num.opr_bitshift_r_assign_(shift);
+        den.opr_bitshift_r_assign_(shift);
+    }
+
+    num.opr_mult_assign_(factor);
+    return basic_N_type::detail::opr_div(num, den).first;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type, typename scaled_type>
+constexpr auto calc::constant_str_(std::size_t digits, scaled_type && scaled) -> std::string {
+    JMATHS_FUNCTION_TO_LOG;
+
+    const basic_N_type ten{10U};
+    const basic_N_type two{2U};
+    const basic_N_type digits_scale = pow(ten, basic_N_type{digits});
+
+    // guard digits absorb the error of scaled; more are needed only if the guard digits of
+    // the value found are within 2 of a carry into or out of the last requested digit
+    for (std::size_t guard = 8U;; guard *= 2U) {
+        const basic_N_type guard_scale = pow(ten, basic_N_type{guard});
+        basic_N_type scale = digits_scale;
+        scale.opr_mult_assign_(guard_scale);
+
+        auto [value, low] =
+            basic_N_type::detail::opr_div(scaled(digits + guard, scale), guard_scale);
+
+        basic_N_type low_ceiling = low;
+        low_ceiling.opr_add_assign_(two);
+        if (basic_N_type::detail::opr_comp(low, two) < 0 ||
+            basic_N_type::detail::opr_comp(low_ceiling, guard_scale) > 0) {
+            continue;
+        }
+
+        std::string str = value.to_str();
+        if (str.size() <= digits) { str.insert(0U, digits + 1U - str.size(), '0'); }
+        if (digits != 0U) { str.insert(str.size() - digits, 1U, '.'); }
+        return str;
+    }
+}
+
+constexpr auto calc::primes_below_(std::uint32_t bound) -> std::vector<std::uint32_t> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // sieve of Eratosthenes on the odd numbers, entry i stands for 2i + 1
+    std::vector<std::uint32_t> primes;
+    if (bound > 2U) { primes.push_back(2U); }
+
+    std::vector<bool> composite(bound / 2U);
+    for (std::uint64_t i = 1U; i < composite.size(); ++i) {
+        if (composite[i]) { continue; }
+
+        const std::uint64_t p = 2U * i + 1U;
+        primes.push_back(static_cast<std::uint32_t>(p));
+        for (std::uint64_t j = p * p / 2U; j < composite.size(); j += p) { composite[j] = true; }
+    }
+
+    return primes;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::product_tree_(std::vector<basic_N_type> values)
+    -> std::vector<std::vector<basic_N_type>> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    assert(!values.empty());
+
+    std::vector<std::vector<basic_N_type>> tree;
+    tree.push_back(std::move(values));
+
+    while (tree.back().size() > 1U) {
+        const std::vector<basic_N_type> & below = tree.back();
+
+        std::vector<basic_N_type> level;
+        level.reserve((below.size() + 1U) / 2U);
+        for (std::size_t i = 0U; i + 1U < below.size(); i += 2U) {
+            basic_N_type & node = level.emplace_back(below[i]);
+            node.opr_mult_assign_(below[i + 1U]);
+        }
+        if (below.size() % 2U == 1U) { level.push_back(below.back()); }
+
+        tree.push_back(std::move(level));
+    }
+
+    return tree;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::remainder_tree_(const basic_N_type & num,
+                                     const std::vector<std::vector<basic_N_type>> & tree,
+                                     bool squared) -> std::vector<basic_N_type> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // x mod m (or m²), without a division if x is already smaller
+    const auto reduce = [squared](const basic_N_type & x, const basic_N_type & node) {
+        basic_N_type square;
+        if (squared) {
+            square = node;
+            square.opr_mult_assign_(node);
+        }
+        const basic_N_type & m = squared ? square : node;
+
+        if (basic_N_type::detail::opr_comp(x, m) < 0) { return x; }
+        return basic_N_type::detail::opr_div(x, m).second;
+    };
 
-    while (basic_N_t::detail::opr_comp(start, end) <= 0) {
-        basic_N_t mid = basic_N_t::detail::opr_add(start, end).opr_bitshift_r_(1U);
+    // (num mod P) mod Q = num mod Q for every node Q below the node P, and the same for
+    // P² and Q²
+    std::vector<basic_N_type> remainders{reduce(num, tree.back().front())};
 
-        const basic_N_t sqr = basic_N_t::detail::opr_mult(mid, mid);
+    for (std::size_t level = tree.size() - 1U; level-- > 0U;) {
+        const std::vector<basic_N_type> & nodes = tree[level];
 
-        const auto compared = basic_N_t::detail::opr_comp(sqr, num);
+        std::vector<basic_N_type> below;
+        below.reserve(nodes.size());
+        for (std::size_t i = 0U; i < nodes.size(); ++i) {
+            below.push_back(reduce(remainders[i / 2U], nodes[i]));
+        }
+
+        remainders = std::move(below);
+    }
+
+    return remainders;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::product_native_(std::span<const std::uint64_t> factors) -> basic_N_type {
+    JMATHS_FUNCTION_TO_LOG;
 
-        if (compared == 0) { return mid; }
+    if (std::ranges::find(factors, 0U) != factors.end()) { return basic_N_type{}; }
 
-        if (compared < 0) {
-            ans = mid;
-            mid.opr_incr_();
-            start = std::move(mid);
+    std::vector<std::uint64_t> words;
+    std::uint64_t word = 1U;
+    for (const std::uint64_t factor : factors) {
+        if (word > std::numeric_limits<std::uint64_t>::max() / factor) {
+            words.push_back(word);
+            word = factor;
         } else {
-            mid.opr_decr_();
-            end = std::move(mid);
+            word *= factor;
         }
     }
+    words.push_back(word);
 
-    return ans;
+    return product(words | std::views::transform([](std::uint64_t w) { return basic_N_type{w}; }));
 }
 
-template <TMP::instance_of<basic_N> basic_N_type_1, TMP::decays_to<basic_N_type_1> basic_N_type_2>
-constexpr auto calc::pow(basic_N_type_1 && base, basic_N_type_2 && exponent)
-    -> std::decay_t<basic_N_type_1> {
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::prime_swing_(std::uint64_t n, std::span<const std::uint32_t> primes)
+    -> basic_N_type {
     JMATHS_FUNCTION_TO_LOG;
 
-    // ALGORITHM: Exponentiation by squaring (binary exponentiation)
-    // Computes base^exponent efficiently using repeated squaring.
-    // This is much faster than repeated multiplication for large exponents.
-    //
-    // The algorithm is based on the binary representation of the exponent:
-    // For example, 3^13 = 3^(1101₂) = 3^8 * 3^4 * 3^1
-    //
-    // Steps:
-    // 1. Initialize result = 1
-    // 2. For each bit in exponent (from least to most significant):
-    //    - If bit is 1: multiply result by current base power
-    //    - Square the base for the next bit position
-    // 3. Return result
-    //
-    // Time complexity: O(log exponent) multiplications instead of O(exponent)
-    // This makes huge exponents feasible (e.g., 2^1000000)
+    std::vector<std::uint64_t> factors;
+    factors.reserve(primes.size());
 
-    using basic_N_t = std::decay_t<basic_N_type_1>;
+    for (const std::uint64_t p : primes) {
+        // primes in (n/2, n] divide n! once and ⌊n/2⌋! not at all
+        if (2U * p > n) {
+            factors.push_back(p);
+            continue;
+        }
 
-    if (exponent.is_zero()) { return basic_N_t::one_; }
+        std::uint64_t power = 1U;
+        for (std::uint64_t q = n / p; q > 0U; q /= p) {
+            if (q % 2U == 1U) { power *= p; }
+        }
 
-    TMP::ref_or_copy_t<decltype(base)> base_num = base;
-    TMP::ref_or_copy_t<decltype(exponent)> exponent_num = exponent;
+        if (power != 1U) { factors.push_back(power); }
+    }
 
-    basic_N_t result(basic_N_t::one_);
+    return product_native_<basic_N_type>(factors);
+}
 
-    for (;;) {
-        // If exponent is odd, multiply result by current base power
-        if (exponent_num.is_odd()) { result.opr_mult_assign_(base_num); }
+constexpr auto calc::small_primes_() -> std::array<std::uint32_t, 172U> {
+    JMATHS_FUNCTION_TO_LOG;
 
-        // Divide exponent by 2 (right shift by 1)
-        exponent_num.opr_bitshift_r_assign_(1U);
-        if (exponent_num.is_zero()) { break; }
+    // sieve of Eratosthenes
+    std::array<bool, 1024U> composite{};
+    std::array<std::uint32_t, 172U> primes{};
 
-        // Square the base for next iteration
-        base_num.opr_mult_assign_(base_num);
+    std::size_t count = 0U;
+    for (std::uint32_t i = 2U; i < composite.size(); ++i) {
+        if (composite[i]) { continue; }
+
+        primes[count++] = i;
+        for (std::uint32_t j = i * i; j < composite.size(); j += i) { composite[j] = true; }
     }
 
-    return result;
+    return primes;
 }
 
-template <TMP::instance_of<basic_N> basic_N_type_1, TMP::decays_to<basic_N_type_1> basic_N_type_2>
-constexpr auto calc::pow_mod(basic_N_type_1 && base,
-                             basic_N_type_2 && exponent,
-                             const std::decay_t<basic_N_type_1> & mod)
-    -> std::decay_t<basic_N_type_1> {
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr std::optional<bool> calc::trial_division_(const basic_N_type & num) {
     JMATHS_FUNCTION_TO_LOG;
 
-    // ALGORITHM: Modular exponentiation by squaring
-    // Computes (base^exponent) mod mod efficiently.
-    // This is crucial for cryptographic applications (e.g., RSA encryption).
-    //
-    // Similar to regular exponentiation by squaring, but we apply the modulo
-    // operation after each multiplication to keep numbers small and prevent overflow.
-    // This is based on the property: (a * b) mod m = ((a mod m) * (b mod m)) mod m
-    //
-    // Without this optimization, computing something like (2^1000000) mod 17
-    // would require storing an astronomically large intermediate result.
-    // With this algorithm, intermediate values never exceed mod².
-    //
-    // Time complexity: O(log exponent) multiplications and modulo operations
+    constexpr auto primes = small_primes_();
+    constexpr std::uint64_t bound = std::uint64_t{1024U} * 1024U;
 
-    using basic_N_t = std::decay_t<basic_N_type_1>;
+    const auto small = num.template fits_into<std::uint64_t>();
 
-    error::division_by_zero::check(mod);
+    if (small && *small < 2U) { return false; }
+
+    const std::vector<std::uint32_t> residues = residues_(num, primes);
 
-    if (exponent.is_zero()) { return basic_N_t::one_; }
+    for (std::size_t i = 0U; i < primes.size(); ++i) {
+        if (residues[i] == 0U) { return small && *small == primes[i]; }
+    }
 
-    TMP::ref_or_copy_t<decltype(base)> base_num = base;
-    TMP::ref_or_copy_t<decltype(exponent)> exponent_num = exponent;
+    if (small && *small < bound) { return true; }
 
-    basic_N_t result(basic_N_t::one_);
+    return std::nullopt;
+}
 
-    for (;;) {
-        if (exponent_num.is_odd()) {
-            result.opr_mult_assign_(base_num);
-            // Apply modulo to keep result small
-            result = basic_N_t::detail::opr_div(result, mod).second;  // .second is the remainder
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr std::optional<basic_N_type> calc::sieve_prime_(basic_N_type start,
+                                                          bitcount_t max_bits,
+                                                          bool safe) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // ALGORITHM: Sieve of Eratosthenes on windows of candidates p = base + step·i
+    // For every odd prime r below 2^16, base mod r gives the first i with r | p, and every
+    // r-th candidate after it is crossed out without touching the big numbers. A safe
+    // prime p = 2q + 1 also needs r ∤ q, which crosses out p ≡ 1 (mod r), and q odd,
+    // which fixes p ≡ 3 (mod 4) with step 4. Only the candidates left over are tested,
+    // about 1 in 10 of the odd numbers (1 in 150 of the numbers ≡ 3 (mod 4) for safe
+    // primes).
+
+    assert(start.bits() > 20U);
+
+    constexpr std::uint32_t sieve_bound = 1U << 16U;
+    constexpr std::size_t window = std::size_t{1U} << 14U;
+
+    // odd primes below sieve_bound
+    std::vector<std::uint32_t> primes = primes_below_(sieve_bound);
+    primes.erase(primes.begin());
+
+    const std::uint32_t step = safe ? 4U : 2U;
+    const std::uint32_t wanted = safe ? 3U : 1U;
+
+    // first number ≡ wanted (mod step) from start, step divides the radix
+    const auto low = static_cast<std::uint32_t>(start.digits_.front() % step);
+    start.opr_add_assign_(basic_N_type{(wanted + step - low) % step});
+
+    // base mod r for every prime r
+    std::vector<std::uint32_t> residues = residues_(start, primes);
+
+    const basic_N_type two{2U};
+
+    std::vector<bool> composite;
+    for (basic_N_type base = std::move(start);;) {
+        composite.assign(window, false);
+
+        for (std::size_t k = 0U; k < primes.size(); ++k) {
+            const std::uint64_t r = primes[k];
+            const std::uint64_t half = (r + 1U) / 2U;                  // 2⁻¹ mod r
+            const std::uint64_t inverse = safe ? half * half % r : half;  // step⁻¹ mod r
+
+            // base + step·i ≡ c (mod r) for i ≡ (c - base)·step⁻¹
+            for (std::uint64_t c = 0U; c < (safe ? 2U : 1U); ++c) {
+                for (std::uint64_t i = (c + r - residues[k]) % r * inverse % r; i < window;
+                     i += r) {
+                    composite[i] = true;
+                }
+            }
+        }
+
+        for (std::size_t i = 0U; i < window; ++i) {
+            if (composite[i]) { continue; }
+
+            basic_N_type candidate = base;
+            candidate.opr_add_assign_(basic_N_type{step * i});
+
+            if (candidate.bits() > max_bits) { return std::nullopt; }
+
+            if (!safe) {
+                if (is_probable_prime(candidate)) { return candidate; }
+                continue;
+            }
+
+            // most composites fail a single strong base-2 test on q or p
+            const basic_N_type q = candidate >> 1U;
+            if (!strong_probable_prime_(montgomery_context<basic_N_type>{q}, two) ||
+                !strong_probable_prime_(montgomery_context<basic_N_type>{candidate}, two)) {
+                continue;
+            }
+
+            if (is_probable_prime(q) && is_probable_prime(candidate)) { return candidate; }
+        }
+
+        base.opr_add_assign_(basic_N_type{step * window});
+        for (std::size_t k = 0U; k < primes.size(); ++k) {
+            residues[k] = static_cast<std::uint32_t>((residues[k] + step * window) % primes[k]);
         }
+    }
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr bool calc::strong_probable_prime_(const montgomery_context<basic_N_type> & ctx,
+                                            const basic_N_type & base) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // ALGORITHM: With num - 1 = d·2^s and d odd, a prime num has base^d ≡ 1 or
+    // base^(d·2^r) ≡ -1 for some r < s
+
+    const basic_N_type & num = ctx.modulus();
+    const basic_N_type num_minus_one = basic_N_type::detail::opr_subtr(num, basic_N_type::one_);
 
-        exponent_num.opr_bitshift_r_assign_(1U);
-        if (exponent_num.is_zero()) { break; }
-        base_num.opr_mult_assign_(base_num);
+    const bitcount_t s = num_minus_one.ctz();
+    const basic_N_type d = num_minus_one >> s;
+
+    const basic_N_type one_m = ctx.to_montgomery(basic_N_type::one_);
+    const basic_N_type minus_one_m = ctx.to_montgomery(num_minus_one);
+
+    basic_N_type x = ctx.to_montgomery(ctx.pow(base, d));
+
+    if (x == one_m || x == minus_one_m) { return true; }
+
+    for (bitcount_t r = 1U; r < s; ++r) {
+        x = ctx.mul(x, x);
+
+        if (x == minus_one_m) { return true; }
+        if (x == one_m) { return false; }
     }
 
-    return result;
+    return false;
 }
 
-template <TMP::instance_of<basic_Z> basic_Z_type, TMP::instance_of<basic_N> basic_N_type>
-constexpr auto calc::pow(basic_Z_type && base, basic_N_type && exponent)
-    -> std::decay_t<basic_Z_type> {
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr bool calc::strong_lucas_probable_prime_(const montgomery_context<basic_N_type> & ctx) {
     JMATHS_FUNCTION_TO_LOG;
 
-    const auto sign =
-        base.is_negative() && exponent.is_odd() ? sign_type::negative : sign_type::positive;
+    // ALGORITHM: Strong Lucas test (Baillie and Wagstaff)
+    // D is the first of 5, -7, 9, -11, ... with (D / num) = -1, P = 1 and
+    // Q = (1 - D) / 4. With num + 1 = d·2^s and d odd, a prime num has U_d ≡ 0 or
+    // V_(d·2^r) ≡ 0 for some r < s. The Lucas sequences are computed from the top bit
+    // of d with
+    //     U_2k = U_k·V_k,    V_2k = V_k² - 2Q^k
+    //     U_(k+1) = (P·U_k + V_k) / 2,    V_(k+1) = (D·U_k + P·V_k) / 2
+    // in Montgomery form, where halving modulo the odd num works as for plain residues.
+
+    const basic_N_type & num = ctx.modulus();
+
+    // every D in the sequence is 1 mod 4, so (D / num) = (num / |D|) by reciprocity
+    std::int64_t D = 5;
+    for (;; D = D > 0 ? -(D + 2) : -D + 2) {
+        const auto abs_D = static_cast<std::uint64_t>(D > 0 ? D : -D);
+        const int jacobi = jacobi_native_(residue_(num, static_cast<std::uint32_t>(abs_D)), abs_D);
+
+        if (jacobi == -1) { break; }
+        // |D| < num after trial division, so |D| is a proper factor
+        if (jacobi == 0) { return false; }
+    }
 
-    return {
-        pow(std::forward<decltype(base)>(base).abs(), std::forward<decltype(exponent)>(exponent)),
-        sign};
+    const std::int64_t q = (1 - D) / 4;  // Q
+
+    // small signed number in Montgomery form
+    const auto to_montgomery = [&](std::int64_t value) {
+        const basic_N_type abs_value{static_cast<std::uint64_t>(value > 0 ? value : -value)};
+        basic_N_type residue = basic_N_type::detail::opr_div(abs_value, num).second;
+        if (value < 0 && !residue.is_zero()) {
+            residue = basic_N_type::detail::opr_subtr(num, residue);
+        }
+        return ctx.to_montgomery(residue);
+    };
+
+    // arithmetic modulo num on residues below num
+    const auto add = [&num](basic_N_type x, const basic_N_type & y) {
+        x.opr_add_assign_(y);
+        if (basic_N_type::detail::opr_comp(x, num) >= 0) { x.opr_subtr_assign_(num); }
+        return x;
+    };
+    const auto sub = [&num](basic_N_type x, const basic_N_type & y) {
+        if (basic_N_type::detail::opr_comp(x, y) < 0) { x.opr_add_assign_(num); }
+        x.opr_subtr_assign_(y);
+        return x;
+    };
+    const auto half = [&num](basic_N_type x) {
+        if (x.is_odd()) { x.opr_add_assign_(num); }
+        x.opr_bitshift_r_assign_(1U);
+        return x;
+    };
+
+    const basic_N_type D_m = to_montgomery(D);
+    const basic_N_type Q_m = to_montgomery(q);
+
+    const basic_N_type num_plus_one = basic_N_type::detail::opr_add(num, basic_N_type::one_);
+    const bitcount_t s = num_plus_one.ctz();
+    const basic_N_type d = num_plus_one >> s;
+
+    // k = 1: U_1 = 1, V_1 = P = 1
+    basic_N_type U = ctx.to_montgomery(basic_N_type::one_);
+    basic_N_type V = U;
+    basic_N_type Q_k = Q_m;
+
+    for (bitcount_t i = d.bits() - 1U; i-- > 0U;) {
+        U = ctx.mul(U, V);
+        V = sub(ctx.mul(V, V), add(Q_k, Q_k));
+        Q_k = ctx.mul(Q_k, Q_k);
+
+        if (d[i]) {
+            basic_N_type next_U = half(add(U, V));
+            V = half(add(ctx.mul(D_m, U), V));
+            U = std::move(next_U);
+            Q_k = ctx.mul(Q_k, Q_m);
+        }
+    }
+
+    if (U.is_zero() || V.is_zero()) { return true; }
+
+    for (bitcount_t r = 1U; r < s; ++r) {
+        V = sub(ctx.mul(V, V), add(Q_k, Q_k));
+        if (V.is_zero()) { return true; }
+        Q_k = ctx.mul(Q_k, Q_k);
+    }
+
+    return false;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::tonelli_shanks_(const montgomery_context<basic_N_type> & ctx,
+                                     const basic_N_type & a) -> std::optional<basic_N_type> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // ALGORITHM: Tonelli-Shanks with p - 1 = q × 2^s, q odd
+    // With w = a^((q - 1) / 2), x = a × w is a root of a × t for t = x × w = a^q, whose
+    // order is a power of 2. Every step multiplies x by a power c of z^q (z a non-residue,
+    // so z^q has order 2^s) that lowers the order of t, until t = 1.
+
+    const basic_N_type & p = ctx.modulus();
+    const basic_N_type p_minus_1 = p - basic_N_type::one_;
+    bitcount_t s = p_minus_1.ctz();
+    const basic_N_type q = p_minus_1 >> s;
+
+    // p is not a square, so (z / p) is a non-principal character and the least z with
+    // (z / p) ≠ 1 is below 2 ln²(p) < bits² (Bach, under GRH); (z / p) = 0 means that z
+    // has a common factor with p
+    const bitcount_t bound = p.bits() * p.bits();
+    basic_N_type z{2U};
+    for (bitcount_t tries = 0U;; ++tries) {
+        const int symbol = jacobi(z, p);
+        if (symbol == -1) { break; }
+        if (symbol == 0 || tries == bound) { return std::nullopt; }
+        z.opr_incr_();
+    }
+
+    const basic_N_type one_m = ctx.to_montgomery(basic_N_type::one_);
+    const basic_N_type w = ctx.to_montgomery(ctx.pow(a, q >> 1U));
+    basic_N_type x = ctx.mul(ctx.to_montgomery(a), w);
+    basic_N_type t = ctx.mul(x, w);
+    basic_N_type c = ctx.to_montgomery(ctx.pow(z, q));
+
+    while (t != one_m) {
+        // least i with t^(2^i) = 1, which is below s if p is prime
+        bitcount_t i = 0U;
+        for (basic_N_type t_power = t; t_power != one_m; t_power = ctx.mul(t_power, t_power)) {
+            if (++i == s) { return std::nullopt; }
+        }
+
+        for (bitcount_t j = i + 1U; j < s; ++j) { c = ctx.mul(c, c); }
+
+        x = ctx.mul(x, c);
+        c = ctx.mul(c, c);
+        t = ctx.mul(t, c);
+        s = i;
+    }
+
+    return ctx.from_montgomery(x);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto calc::cipolla_(const montgomery_context<basic_N_type> & ctx, const basic_N_type & a)
+    -> std::optional<basic_N_type> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // ALGORITHM: Cipolla
+    // For t with w = t² - a a non-residue, (t + √w)^((p + 1) / 2) lies in the prime field
+    // and is a root of a. The power is taken in F_p(√w), (x + y√w) with x and y mod p.
+
+    const basic_N_type & p = ctx.modulus();
+
+    const auto add = [&p](basic_N_type & x, const basic_N_type & y) {
+        x.opr_add_assign_(y);
+        if (basic_N_type::detail::opr_comp(x, p) >= 0) { x.opr_subtr_assign_(p); }
+    };
+
+    // about half of all t give a non-residue w (p is not a square), the search stops after
+    // as many tries as in tonelli_shanks_(); w = 0 means that t is a root already
+    const bitcount_t bound = p.bits() * p.bits();
+    basic_N_type t = basic_N_type::one_;
+    basic_N_type w;
+    for (bitcount_t tries = 0U;; ++tries) {
+        w = basic_N_type::detail::opr_div(t * t + p - a, p).second;
+        if (w.is_zero()) { return t; }
+        const int symbol = jacobi(w, p);
+        if (symbol == -1) { break; }
+        if (symbol == 0 || tries == bound) { return std::nullopt; }
+        t.opr_incr_();
+    }
+
+    const basic_N_type t_m = ctx.to_montgomery(t);
+    const basic_N_type w_m = ctx.to_montgomery(w);
+
+    basic_N_type x = t_m;  // the top bit of the exponent
+    basic_N_type y = ctx.to_montgomery(basic_N_type::one_);
+
+    const basic_N_type exponent = (p >> 1U) + basic_N_type::one_;
+
+    for (bitcount_t i = exponent.bits() - 1U; i-- > 0U;) {
+        // (x + y√w)² = x² + w y² + 2xy√w
+        basic_N_type xy = ctx.mul(x, y);
+        x = ctx.mul(x, x);
+        add(x, ctx.mul(w_m, ctx.mul(y, y)));
+        y = xy;
+        add(y, xy);
+
+        if (exponent[i]) {
+            // (x + y√w)(t + √w) = xt + yw + (x + yt)√w
+            basic_N_type next_x = ctx.mul(x, t_m);
+            add(next_x, ctx.mul(y, w_m));
+            add(x, ctx.mul(y, t_m));
+            y = std::move(x);
+            x = std::move(next_x);
+        }
+    }
+
+    return ctx.from_montgomery(x);
+}
+
+constexpr int calc::jacobi_native_(std::uint64_t a, std::uint64_t n) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    assert(n % 2U == 1U);
+
+    // binary algorithm as in jacobi(), without any division
+    int result = 1;
+
+    while (a != 0U) {
+        // (2 / n) = -1 for n ≡ 3, 5 (mod 8)
+        const int shift = std::countr_zero(a);
+        a >>= shift;
+        if (shift % 2 == 1 && (n % 8U == 3U || n % 8U == 5U)) { result = -result; }
+
+        // reciprocity: the sign flips if both are 3 mod 4
+        if (a < n) {
+            std::swap(a, n);
+            if (a % 4U == 3U && n % 4U == 3U) { result = -result; }
+        }
+
+        a -= n;
+    }
+
+    return n == 1U ? result : 0;
+}
+
+constexpr std::uint64_t calc::sqrt_native_(std::uint64_t num) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    std::uint64_t root;
+
+    if consteval {
+        // Newton's iteration from above, decreasing until it stops
+        root = num;
+        for (std::uint64_t next = (root + 1U) / 2U; next < root; next = (next + num / next) / 2U) {
+            root = next;
+        }
+    } else {
+        // a double holds num exactly, its rounded square root is off by at most 1
+        root = static_cast<std::uint64_t>(std::sqrt(static_cast<double>(num)));
+    }
+
+    while (root * root > num) { --root; }
+    while ((root + 1U) * (root + 1U) <= num) { ++root; }
+
+    return root;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr void calc::mul_mod_(basic_N_type & x, const basic_N_type & y, const basic_N_type & mod) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    x.opr_mult_assign_(y);
+    if (basic_N_type::detail::opr_comp(x, mod) >= 0) {
+        x = basic_N_type::detail::opr_div(x, mod).second;
+    }
 }
 
 }  // namespace jmaths
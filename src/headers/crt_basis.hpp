@@ -0,0 +1,105 @@
+// The jmaths library for C++
+// Copyright (C) 2025  Jasper de Smaele
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "TMP.hpp"
+#include "constants_and_types.hpp"
+#include "declarations.hpp"
+
+/**
+ * @file crt_basis.hpp
+ * @brief Chinese remainder reconstruction for a fixed set of moduli
+ *
+ * For pairwise coprime moduli m_0, ..., m_(k-1) with product M, every vector of residues
+ * r_i belongs to exactly one x in [0, M) with x ≡ r_i (mod m_i):
+ *     x = Σ (r_i × c_i mod m_i) × M/m_i mod M,    c_i = (M/m_i)⁻¹ mod m_i
+ * The product tree of the moduli and the c_i only depend on the moduli and are computed
+ * once. The sum is then formed up the tree: a node with children L and R holds
+ * v_L × P_R + v_R × P_L, where P is the product of the moduli below a node, so every
+ * multiplication has operands of about the same length.
+ *
+ * USAGE:
+ * ```cpp
+ * const std::vector<N> primes{...};               // e.g. word-sized primes
+ * const jmaths::crt_basis<N> basis(primes);
+ * N x = basis.reconstruct(residues);              // x mod primes[i] == residues[i]
+ * Z y = basis.reconstruct_signed(residues);       // same, in (-M/2, M/2]
+ * ```
+ *
+ * THREAD SAFETY: A basis is immutable after construction and can be shared.
+ */
+
+namespace jmaths {
+
+/**
+ * @class crt_basis
+ * @brief Precomputed product tree and inverses for Chinese remainder reconstruction
+ * @tparam basic_N_type basic_N type of the moduli and residues
+ */
+template <TMP::instance_of<basic_N> basic_N_type> class crt_basis {
+    using basic_Z_type = typename basic_N_type::basic_Z_type;
+
+   public:
+    /**
+     * @brief Precompute the product tree and the inverses
+     * @param moduli Pairwise coprime moduli (at least one)
+     * @throws error::division_by_zero if a modulus is zero
+     * @throws error::invalid_modulus if two moduli have a common factor
+     *
+     * COMPLEXITY: One product tree, one remainder tree of M modulo the squared nodes and
+     * one modular inversion per modulus
+     */
+    explicit constexpr crt_basis(std::span<const basic_N_type> moduli);
+
+    /**
+     * @brief The product M of the moduli
+     */
+    [[nodiscard]] constexpr const basic_N_type & modulus() const;
+
+    /**
+     * @brief Number of moduli
+     */
+    [[nodiscard]] constexpr std::size_t size() const;
+
+    /**
+     * @brief Reconstruct a number from its residues
+     * @param residues One residue per modulus, in the order of the moduli (any size)
+     * @return The x in [0, M) with x ≡ residues[i] modulo moduli[i]
+     */
+    [[nodiscard]] constexpr basic_N_type reconstruct(
+        std::span<const basic_N_type> residues) const;
+
+    /**
+     * @brief Reconstruct a signed number from its residues
+     * @param residues One residue per modulus, in the order of the moduli (any size)
+     * @return The x in (-M/2, M/2] with x ≡ residues[i] modulo moduli[i]
+     */
+    [[nodiscard]] constexpr basic_Z_type reconstruct_signed(
+        std::span<const basic_N_type> residues) const;
+
+   private:
+    std::vector<std::vector<basic_N_type>> tree_;  // levels, from the moduli up to M
+    std::vector<basic_N_type> inverses_;           // c_i = (M/m_i)⁻¹ mod m_i
+};
+
+}  // namespace jmaths
+
+#include "crt_basis_impl.hpp"
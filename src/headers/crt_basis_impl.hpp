@@ -0,0 +1,132 @@
+// The jmaths library for C++
+// Copyright (C) 2025  Jasper de Smaele
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "TMP.hpp"
+#include "basic_N.hpp"
+#include "basic_Z.hpp"
+#include "calc.hpp"
+#include "constants_and_types.hpp"
+#include "crt_basis.hpp"
+#include "def.hh"
+#include "error.hpp"
+
+// member functions of crt_basis
+namespace jmaths {
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr crt_basis<basic_N_type>::crt_basis(std::span<const basic_N_type> moduli) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    assert(!moduli.empty());
+
+    for (const basic_N_type & modulus : moduli) { error::division_by_zero::check(modulus); }
+
+    tree_ = calc::product_tree_(std::vector<basic_N_type>(moduli.begin(), moduli.end()));
+
+    // M mod P² for every node P on the way down (a remainder tree of M modulo the squared
+    // nodes), which ends in M mod m_i² = (M/m_i mod m_i) × m_i
+    const std::vector<basic_N_type> remainders = calc::remainder_tree_(modulus(), tree_, true);
+
+    inverses_.reserve(moduli.size());
+    for (std::size_t i = 0U; i < moduli.size(); ++i) {
+        auto cofactor = basic_N_type::detail::opr_div(remainders[i], moduli[i]).first;
+
+        std::optional<basic_N_type> inverse = calc::mod_inverse(std::move(cofactor), moduli[i]);
+        if (!inverse) {
+            throw error::invalid_modulus("The moduli of a CRT basis must be pairwise coprime!");
+        }
+
+        inverses_.push_back(*std::move(inverse));
+    }
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr const basic_N_type & crt_basis<basic_N_type>::modulus() const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    return tree_.back().front();
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr std::size_t crt_basis<basic_N_type>::size() const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    return tree_.front().size();
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type crt_basis<basic_N_type>::reconstruct(
+    std::span<const basic_N_type> residues) const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    assert(residues.size() == size());
+
+    const std::vector<basic_N_type> & moduli = tree_.front();
+
+    // v_i = r_i × c_i mod m_i
+    std::vector<basic_N_type> values;
+    values.reserve(moduli.size());
+    for (std::size_t i = 0U; i < moduli.size(); ++i) {
+        basic_N_type value = residues[i];
+        value.opr_mult_assign_(inverses_[i]);
+        values.push_back(basic_N_type::detail::opr_div(value, moduli[i]).second);
+    }
+
+    // a node holds Σ v_i × P/m_i over the moduli m_i below its product P
+    for (std::size_t level = 0U; level + 1U < tree_.size(); ++level) {
+        const std::vector<basic_N_type> & nodes = tree_[level];
+
+        std::vector<basic_N_type> above;
+        above.reserve((nodes.size() + 1U) / 2U);
+        for (std::size_t i = 0U; i + 1U < nodes.size(); i += 2U) {
+            basic_N_type & sum = above.emplace_back(std::move(values[i]));
+            sum.opr_mult_assign_(nodes[i + 1U]);
+            sum.opr_addmul_assign_(values[i + 1U], nodes[i]);
+        }
+        if (nodes.size() % 2U == 1U) { above.push_back(std::move(values.back())); }
+
+        values = std::move(above);
+    }
+
+    // the sum is below size() × M
+    return basic_N_type::detail::opr_div(values.front(), modulus()).second;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto crt_basis<basic_N_type>::reconstruct_signed(
+    std::span<const basic_N_type> residues) const -> basic_Z_type {
+    JMATHS_FUNCTION_TO_LOG;
+
+    basic_N_type x = reconstruct(residues);
+
+    // x > M/2 stands for x - M
+    if (basic_N_type::detail::opr_comp(x << 1U, modulus()) > 0) {
+        return -basic_Z_type{basic_N_type::detail::opr_subtr(modulus(), x)};
+    }
+
+    return basic_Z_type{std::move(x)};
+}
+
+}  // namespace jmaths
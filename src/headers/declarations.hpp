@@ -105,4 +105,47 @@ template <bitcount_t V>
     requires TMP::is_power_of_2<V>
 class uint;
 
+/**
+ * @class montgomery_context
+ * @brief Precomputed Montgomery reduction for an odd modulus (forward declaration)
+ * @tparam T basic_N type of the modulus
+ * Full definition in montgomery.hpp
+ */
+template <TMP::instance_of<basic_N> T> class montgomery_context;
+
+/**
+ * @class barrett_context
+ * @brief Precomputed Barrett reduction for a fixed modulus (forward declaration)
+ * @tparam T basic_N type of the modulus
+ * Full definition in barrett.hpp
+ */
+template <TMP::instance_of<basic_N> T> class barrett_context;
+
+/**
+ * @class fixed_base_pow
+ * @brief Precomputed comb tables for powers of a fixed base (forward declaration)
+ * @tparam T basic_N type of the base and modulus
+ * Full definition in fixed_base_pow.hpp
+ */
+template <TMP::instance_of<basic_N> T> class fixed_base_pow;
+
+/**
+ * @class crt_basis
+ * @brief Precomputed Chinese remainder reconstruction for fixed moduli (forward declaration)
+ * @tparam T basic_N type of the moduli
+ * Full definition in crt_basis.hpp
+ */
+template <TMP::instance_of<basic_N> T> class crt_basis;
+
+namespace expr {
+
+/**
+ * @struct evaluator
+ * @brief Evaluation engine for expression templates (forward declaration)
+ * Full definition in expression.hpp
+ */
+struct evaluator;
+
+}  // namespace expr
+
 }  // namespace jmaths
@@ -37,6 +37,7 @@ class error : public std::exception {
 
     class division_by_zero;
     class invalid_base;
+    class invalid_modulus;
 
     error();
     explicit error(std::string_view message);
@@ -100,6 +101,21 @@ class error::invalid_base : public error {
     static constexpr unsigned maximum_base = 64U;
 };
 
+/**
+ * @class error::invalid_modulus
+ * @brief Exception thrown when a modulus does not meet the requirements of an algorithm
+ *
+ * USAGE: Thrown by montgomery_context for an even modulus, by crt_basis for moduli that
+ * are not pairwise coprime, and by calc::jacobi and calc::sqrt_mod for an even modulus.
+ */
+class error::invalid_modulus : public error {
+   public:
+    static constexpr char default_message[] = "The modulus is not valid for this operation!";
+
+    invalid_modulus();
+    explicit invalid_modulus(std::string_view message);
+};
+
 }  // namespace jmaths
 
 #include "error_impl.hpp"
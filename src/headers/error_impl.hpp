@@ -116,4 +116,18 @@ constexpr void error::invalid_base::check(unsigned base) {
     throw invalid_base(std::format("{} The base you entered was: {}.", default_message, base));
 }
 
+/**
+ * @brief Default constructor for invalid_modulus
+ */
+inline error::invalid_modulus::invalid_modulus() : error(default_message) {
+    JMATHS_FUNCTION_TO_LOG;
+}
+
+/**
+ * @brief Constructor with custom message for invalid_modulus
+ */
+inline error::invalid_modulus::invalid_modulus(std::string_view message) : error(message) {
+    JMATHS_FUNCTION_TO_LOG;
+}
+
 }  // namespace jmaths
@@ -0,0 +1,285 @@
+// The jmaths library for C++
+// Copyright (C) 2025  Jasper de Smaele
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+#include "TMP.hpp"
+#include "basic_N.hpp"
+#include "basic_Q.hpp"
+#include "basic_Z.hpp"
+#include "constants_and_types.hpp"
+#include "declarations.hpp"
+
+/**
+ * @file expression.hpp
+ * @brief Opt-in expression templates for N, Z and Q
+ *
+ * Wrapping an operand in expr::lazy() makes the arithmetic operators build a tree of
+ * lightweight nodes instead of computing intermediate numbers. The tree is evaluated
+ * only when it is assigned, converted or accumulated into a number.
+ *
+ * KEY FEATURES:
+ * - The destination is sized once from an upper bound of the result
+ * - Products are accumulated with fused kernels (addmul / submul) instead of being
+ *   materialised, and a product followed by a left shift uses a digit offset
+ * - Sums and differences are flattened into a sequence of in-place updates
+ *
+ * USAGE:
+ * ```cpp
+ * using jmaths::expr::lazy;
+ * N r = lazy(a) * b + lazy(c) * d - e;  // one allocation for r, no temporaries
+ * acc += lazy(x) * y;                    // acc += x*y without a product temporary
+ * jmaths::expr::assign(r, (lazy(a) * b) << 64U);  // reuses the storage of r
+ * ```
+ *
+ * SEMANTICS: The result is always the same as with the ordinary operators. In
+ * particular N subtraction keeps its absolute difference semantics; subexpressions
+ * for which flattening would change the result are evaluated into a temporary.
+ *
+ * LIFETIME: Nodes hold references to their operands. An expression must be evaluated
+ * within the full-expression that created it and must not be stored (e.g. in `auto`).
+ */
+
+// declarations of expression nodes and associated functions
+namespace jmaths::expr {
+
+/**
+ * @brief Operation tags of binary nodes
+ */
+struct add_tag {};
+struct subtr_tag {};
+struct mult_tag {};
+
+template <typename T> class terminal;
+template <typename Op, typename L, typename R> class binary;
+template <typename E> class shift_l;
+
+/**
+ * @concept expression
+ * @brief Checks if T is an expression node
+ */
+template <typename T>
+concept expression = TMP::instance_of<T, terminal, binary, shift_l>;
+
+/**
+ * @brief Checks if E is a product node
+ */
+template <typename E> inline constexpr bool is_product_v = false;
+
+template <typename L, typename R> inline constexpr bool is_product_v<binary<mult_tag, L, R>> = true;
+
+/**
+ * @brief Value type of an expression, or the type itself for a plain number
+ */
+template <typename T> struct value_type_of {
+    using type = std::decay_t<T>;
+};
+
+template <expression T> struct value_type_of<T> {
+    using type = typename std::decay_t<T>::value_type;
+};
+
+template <typename T> using value_type_of_t = typename value_type_of<T>::type;
+
+/**
+ * @concept operands
+ * @brief Checks if L and R can be combined into an expression node
+ * At least one of them must be an expression and both must have the same number type.
+ */
+template <typename L, typename R>
+concept operands = (expression<L> || expression<R>) &&
+                   std::same_as<value_type_of_t<L>, value_type_of_t<R>> &&
+                   TMP::instance_of<value_type_of_t<L>, basic_N, basic_Z, basic_Q>;
+
+/**
+ * @brief Node type used for an operand (plain numbers become terminals)
+ */
+template <typename T>
+using node_t = std::conditional_t<expression<T>, std::decay_t<T>, terminal<std::decay_t<T>>>;
+
+/**
+ * @brief Start an expression from a number
+ * @param value Number to wrap (must outlive the evaluation of the expression)
+ * @return Terminal node referring to value
+ */
+template <TMP::instance_of<basic_N, basic_Z, basic_Q> T>
+[[nodiscard]] constexpr terminal<T> lazy(const T & value);
+
+template <typename T> void lazy(const T &&) = delete;
+
+template <typename L, typename R>
+    requires operands<L, R>
+[[nodiscard]] constexpr binary<add_tag, node_t<L>, node_t<R>> operator+(const L & lhs,
+                                                                       const R & rhs);
+
+template <typename L, typename R>
+    requires operands<L, R>
+[[nodiscard]] constexpr binary<subtr_tag, node_t<L>, node_t<R>> operator-(const L & lhs,
+                                                                         const R & rhs);
+
+template <typename L, typename R>
+    requires operands<L, R>
+[[nodiscard]] constexpr binary<mult_tag, node_t<L>, node_t<R>> operator*(const L & lhs,
+                                                                        const R & rhs);
+
+template <expression E> [[nodiscard]] constexpr shift_l<E> operator<<(const E & e, bitcount_t pos);
+
+/**
+ * @brief Evaluate an expression into dest, reusing the storage of dest
+ * @return Reference to dest
+ */
+template <expression E> constexpr auto assign(value_type_of_t<E> & dest, const E & e)
+    -> value_type_of_t<E> &;
+
+/**
+ * @brief Accumulate an expression into dest (fused multiply-add for products)
+ * @return Reference to dest
+ */
+template <expression E> constexpr auto operator+=(value_type_of_t<E> & dest, const E & e)
+    -> value_type_of_t<E> &;
+
+/**
+ * @brief Subtract an expression from dest (fused multiply-subtract for products)
+ * @return Reference to dest
+ */
+template <expression E> constexpr auto operator-=(value_type_of_t<E> & dest, const E & e)
+    -> value_type_of_t<E> &;
+
+/**
+ * @class node
+ * @brief CRTP base of all expression nodes
+ *
+ * Provides the value type and the conversions that trigger evaluation.
+ */
+template <typename Derived, typename T> class node {
+   public:
+    using value_type = T;
+
+    /**
+     * @brief Evaluate the expression into a new number
+     */
+    [[nodiscard]] constexpr value_type eval() const;
+
+    /**
+     * @brief Implicit evaluation, e.g. `N r = lazy(a) * b + c;`
+     */
+    constexpr operator value_type() const;
+};
+
+/**
+ * @class terminal
+ * @brief Leaf node referring to a number
+ */
+template <typename T> class terminal : public node<terminal<T>, T> {
+   public:
+    explicit constexpr terminal(const T & value);
+
+    [[nodiscard]] constexpr const T & value() const;
+
+   private:
+    const T & value_;
+};
+
+/**
+ * @class binary
+ * @brief Node combining two subexpressions with Op (add_tag, subtr_tag or mult_tag)
+ */
+template <typename Op, typename L, typename R>
+class binary : public node<binary<Op, L, R>, typename L::value_type> {
+   public:
+    using operation = Op;
+
+    constexpr binary(const L & lhs, const R & rhs);
+
+    [[nodiscard]] constexpr const L & lhs() const;
+    [[nodiscard]] constexpr const R & rhs() const;
+
+   private:
+    L lhs_;
+    R rhs_;
+};
+
+/**
+ * @class shift_l
+ * @brief Node shifting a subexpression left by a number of bits
+ * A shifted product is evaluated without a separate shift pass.
+ */
+template <typename E> class shift_l : public node<shift_l<E>, typename E::value_type> {
+   public:
+    constexpr shift_l(const E & e, bitcount_t pos);
+
+    [[nodiscard]] constexpr const E & expr() const;
+    [[nodiscard]] constexpr bitcount_t pos() const;
+
+   private:
+    E expr_;
+    bitcount_t pos_;
+};
+
+/**
+ * @struct evaluator
+ * @brief Evaluation engine for expression trees
+ *
+ * DESIGN: A struct of static functions (like calc) so that basic_N and basic_Z can
+ * grant it access to their fused kernels.
+ *
+ * STRATEGY:
+ * - eval_: evaluate the left spine into the destination, accumulate the rest
+ * - accumulate_: dest ± subexpression, products go to the fused kernels
+ * - If the destination also appears as an operand (other than the first terminal of
+ *   the left spine), the expression is evaluated into a temporary first
+ */
+struct evaluator {
+    template <expression E> [[nodiscard]] static constexpr auto evaluate(const E & e)
+        -> value_type_of_t<E>;
+
+    template <expression E> static constexpr void assign(value_type_of_t<E> & dest, const E & e);
+
+    template <expression E>
+    static constexpr void accumulate(value_type_of_t<E> & dest, const E & e, bool subtract);
+
+   private:
+    template <typename T, typename E> static constexpr void eval_(T & dest, const E & e);
+
+    template <typename T, typename E>
+    static constexpr void accumulate_(T & dest, const E & e, bool subtract);
+
+    template <typename T>
+    static constexpr void accumulate_product_(T & dest,
+                                              const T & lhs,
+                                              const T & rhs,
+                                              bool subtract,
+                                              bitcount_t pos);
+
+    template <typename E> [[nodiscard]] static constexpr decltype(auto) operand_(const E & e);
+
+    template <typename T, typename E>
+    [[nodiscard]] static constexpr bool aliases_(const T & dest, const E & e, bool on_spine);
+
+    template <typename E> [[nodiscard]] static constexpr std::size_t digit_estimate_(const E & e);
+
+    template <typename T> static constexpr void clear_(T & dest);
+
+    template <typename T> static constexpr void reserve_(T & dest, std::size_t digits);
+};
+
+}  // namespace jmaths::expr
+
+#include "expression_impl.hpp"
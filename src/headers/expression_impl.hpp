@@ -0,0 +1,371 @@
+// The jmaths library for C++
+// Copyright (C) 2025  Jasper de Smaele
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "TMP.hpp"
+#include "basic_N.hpp"
+#include "basic_Q.hpp"
+#include "basic_Z.hpp"
+#include "constants_and_types.hpp"
+#include "def.hh"
+#include "expression.hpp"
+
+// functions building expression nodes
+namespace jmaths::expr {
+
+/**********************************************************/
+// forwarding functions
+
+template <TMP::instance_of<basic_N, basic_Z, basic_Q> T>
+constexpr terminal<T> lazy(const T & value) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    return terminal<T>{value};
+}
+
+template <typename L, typename R>
+    requires operands<L, R>
+constexpr binary<add_tag, node_t<L>, node_t<R>> operator+(const L & lhs, const R & rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    return {node_t<L>(lhs), node_t<R>(rhs)};
+}
+
+template <typename L, typename R>
+    requires operands<L, R>
+constexpr binary<subtr_tag, node_t<L>, node_t<R>> operator-(const L & lhs, const R & rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    return {node_t<L>(lhs), node_t<R>(rhs)};
+}
+
+template <typename L, typename R>
+    requires operands<L, R>
+constexpr binary<mult_tag, node_t<L>, node_t<R>> operator*(const L & lhs, const R & rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    return {node_t<L>(lhs), node_t<R>(rhs)};
+}
+
+template <expression E> constexpr shift_l<E> operator<<(const E & e, bitcount_t pos) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    return {e, pos};
+}
+
+template <expression E> constexpr auto assign(value_type_of_t<E> & dest, const E & e)
+    -> value_type_of_t<E> & {
+    JMATHS_FUNCTION_TO_LOG;
+
+    evaluator::assign(dest, e);
+    return dest;
+}
+
+template <expression E> constexpr auto operator+=(value_type_of_t<E> & dest, const E & e)
+    -> value_type_of_t<E> & {
+    JMATHS_FUNCTION_TO_LOG;
+
+    evaluator::accumulate(dest, e, false);
+    return dest;
+}
+
+template <expression E> constexpr auto operator-=(value_type_of_t<E> & dest, const E & e)
+    -> value_type_of_t<E> & {
+    JMATHS_FUNCTION_TO_LOG;
+
+    evaluator::accumulate(dest, e, true);
+    return dest;
+}
+
+}  // namespace jmaths::expr
+
+// member functions of the expression nodes
+namespace jmaths::expr {
+
+template <typename Derived, typename T> constexpr auto node<Derived, T>::eval() const -> value_type {
+    JMATHS_FUNCTION_TO_LOG;
+
+    return evaluator::evaluate(static_cast<const Derived &>(*this));
+}
+
+template <typename Derived, typename T> constexpr node<Derived, T>::operator value_type() const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    return eval();
+}
+
+template <typename T> constexpr terminal<T>::terminal(const T & value) : value_(value) {
+    JMATHS_FUNCTION_TO_LOG;
+}
+
+template <typename T> constexpr const T & terminal<T>::value() const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    return value_;
+}
+
+template <typename Op, typename L, typename R>
+constexpr binary<Op, L, R>::binary(const L & lhs, const R & rhs) : lhs_(lhs), rhs_(rhs) {
+    JMATHS_FUNCTION_TO_LOG;
+}
+
+template <typename Op, typename L, typename R> constexpr const L & binary<Op, L, R>::lhs() const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    return lhs_;
+}
+
+template <typename Op, typename L, typename R> constexpr const R & binary<Op, L, R>::rhs() const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    return rhs_;
+}
+
+template <typename E>
+constexpr shift_l<E>::shift_l(const E & e, bitcount_t pos) : expr_(e), pos_(pos) {
+    JMATHS_FUNCTION_TO_LOG;
+}
+
+template <typename E> constexpr const E & shift_l<E>::expr() const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    return expr_;
+}
+
+template <typename E> constexpr bitcount_t shift_l<E>::pos() const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    return pos_;
+}
+
+}  // namespace jmaths::expr
+
+// member functions of evaluator
+namespace jmaths::expr {
+
+template <expression E> constexpr auto evaluator::evaluate(const E & e) -> value_type_of_t<E> {
+    JMATHS_FUNCTION_TO_LOG;
+
+    value_type_of_t<E> result;
+    reserve_(result, digit_estimate_(e));
+    eval_(result, e);
+    return result;
+}
+
+template <expression E> constexpr void evaluator::assign(value_type_of_t<E> & dest, const E & e) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    if (aliases_(dest, e, true)) {
+        dest = evaluate(e);
+        return;
+    }
+
+    reserve_(dest, digit_estimate_(e));
+    eval_(dest, e);
+}
+
+template <expression E>
+constexpr void evaluator::accumulate(value_type_of_t<E> & dest, const E & e, bool subtract) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    if (aliases_(dest, e, false)) {
+        const value_type_of_t<E> value = evaluate(e);
+        accumulate_(dest, terminal<value_type_of_t<E>>{value}, subtract);
+        return;
+    }
+
+    accumulate_(dest, e, subtract);
+}
+
+template <typename T, typename E> constexpr void evaluator::eval_(T & dest, const E & e) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // ALGORITHM: The leftmost operand of a sum/difference chain is copied into dest
+    // (a no-op if it is dest itself), every other operand is accumulated in place.
+    // Products start from zero so that they can be accumulated with the fused kernels.
+
+    if constexpr (TMP::is_instance_of_v<E, terminal>) {
+        dest = e.value();
+    } else if constexpr (TMP::is_instance_of_v<E, shift_l>) {
+        if constexpr (is_product_v<std::decay_t<decltype(e.expr())>>) {
+            clear_(dest);
+            accumulate_(dest, e, false);
+        } else {
+            eval_(dest, e.expr());
+            dest <<= e.pos();
+        }
+    } else if constexpr (std::is_same_v<typename E::operation, mult_tag>) {
+        clear_(dest);
+        accumulate_(dest, e, false);
+    } else {
+        eval_(dest, e.lhs());
+        accumulate_(dest, e.rhs(), std::is_same_v<typename E::operation, subtr_tag>);
+    }
+}
+
+template <typename T, typename E>
+constexpr void evaluator::accumulate_(T & dest, const E & e, bool subtract) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    if constexpr (TMP::is_instance_of_v<E, terminal>) {
+        if (subtract) {
+            dest -= e.value();
+        } else {
+            dest += e.value();
+        }
+    } else if constexpr (TMP::is_instance_of_v<E, shift_l>) {
+        if constexpr (is_product_v<std::decay_t<decltype(e.expr())>>) {
+            accumulate_product_(
+                dest, operand_(e.expr().lhs()), operand_(e.expr().rhs()), subtract, e.pos());
+        } else {
+            T shifted = evaluate(e.expr());
+            shifted <<= e.pos();
+            accumulate_(dest, terminal<T>{shifted}, subtract);
+        }
+    } else if constexpr (std::is_same_v<typename E::operation, mult_tag>) {
+        accumulate_product_(dest, operand_(e.lhs()), operand_(e.rhs()), subtract, 0U);
+    } else {
+        constexpr bool is_difference = std::is_same_v<typename E::operation, subtr_tag>;
+
+        if constexpr (TMP::is_instance_of_v<T, basic_N>) {
+            // N subtraction yields |x - y|, so only dest + (x + y) == (dest + x) + y may be
+            // flattened; anything else is evaluated on its own first
+            if (!subtract && !is_difference) {
+                accumulate_(dest, e.lhs(), false);
+                accumulate_(dest, e.rhs(), false);
+            } else {
+                const T value = evaluate(e);
+                accumulate_(dest, terminal<T>{value}, subtract);
+            }
+        } else {
+            accumulate_(dest, e.lhs(), subtract);
+            accumulate_(dest, e.rhs(), subtract != is_difference);
+        }
+    }
+}
+
+template <typename T>
+constexpr void evaluator::accumulate_product_(T & dest,
+                                              const T & lhs,
+                                              const T & rhs,
+                                              bool subtract,
+                                              bitcount_t pos) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    if constexpr (TMP::is_instance_of_v<T, basic_Q>) {
+        if (subtract) {
+            dest -= (lhs * rhs) << pos;
+        } else {
+            dest += (lhs * rhs) << pos;
+        }
+    } else {
+        constexpr bitcount_t digit_bits = T::base_int_type_bits;
+
+        const std::size_t digit_offset = pos / digit_bits;
+
+        // whole digits are handled by the kernels, only the remaining bits need a shift
+        if (const bitcount_t pos_mod = pos % digit_bits; pos_mod != 0U) {
+            const T shifted = lhs << pos_mod;
+            accumulate_product_(dest, shifted, rhs, subtract, digit_offset * digit_bits);
+            return;
+        }
+
+        if constexpr (TMP::is_instance_of_v<T, basic_N>) {
+            if (subtract) {
+                dest.opr_submul_assign_(lhs, rhs, digit_offset);
+            } else {
+                dest.opr_addmul_assign_(lhs, rhs, digit_offset);
+            }
+        } else {
+            dest.opr_addmul_assign_(lhs, rhs, subtract, digit_offset);
+        }
+    }
+}
+
+template <typename E> constexpr decltype(auto) evaluator::operand_(const E & e) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    if constexpr (TMP::is_instance_of_v<E, terminal>) {
+        return e.value();
+    } else {
+        return evaluate(e);
+    }
+}
+
+template <typename T, typename E>
+constexpr bool evaluator::aliases_(const T & dest, const E & e, bool on_spine) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // on_spine: e is evaluated first into dest, so dest being that operand is harmless
+
+    if constexpr (TMP::is_instance_of_v<E, terminal>) {
+        return !on_spine && &e.value() == &dest;
+    } else if constexpr (TMP::is_instance_of_v<E, shift_l>) {
+        return aliases_(dest, e.expr(), on_spine);
+    } else if constexpr (std::is_same_v<typename E::operation, mult_tag>) {
+        return aliases_(dest, e.lhs(), false) || aliases_(dest, e.rhs(), false);
+    } else {
+        return aliases_(dest, e.lhs(), on_spine) || aliases_(dest, e.rhs(), false);
+    }
+}
+
+template <typename E> constexpr std::size_t evaluator::digit_estimate_(const E & e) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // upper bound of the number of digits of the result
+
+    using T = value_type_of_t<E>;
+
+    if constexpr (TMP::is_instance_of_v<T, basic_Q>) {
+        return 0U;
+    } else if constexpr (TMP::is_instance_of_v<E, terminal>) {
+        return (e.value().bits() + T::base_int_type_bits - 1U) / T::base_int_type_bits;
+    } else if constexpr (TMP::is_instance_of_v<E, shift_l>) {
+        return digit_estimate_(e.expr()) + e.pos() / T::base_int_type_bits + 1U;
+    } else if constexpr (std::is_same_v<typename E::operation, mult_tag>) {
+        return digit_estimate_(e.lhs()) + digit_estimate_(e.rhs());
+    } else {
+        return std::max(digit_estimate_(e.lhs()), digit_estimate_(e.rhs())) + 1U;
+    }
+}
+
+template <typename T> constexpr void evaluator::clear_(T & dest) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    if constexpr (TMP::is_instance_of_v<T, basic_Q>) {
+        dest = T{};
+    } else {
+        dest.set_zero();
+    }
+}
+
+template <typename T> constexpr void evaluator::reserve_(T & dest, std::size_t digits) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    if constexpr (TMP::is_instance_of_v<T, basic_N>) {
+        dest.digits_.reserve(digits);
+    } else if constexpr (TMP::is_instance_of_v<T, basic_Z>) {
+        static_cast<typename T::basic_N_type &>(dest).digits_.reserve(digits);
+    }
+}
+
+}  // namespace jmaths::expr
@@ -0,0 +1,143 @@
+// The jmaths library for C++
+// Copyright (C) 2025  Jasper de Smaele
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstddef>
+#include <variant>
+#include <vector>
+
+#include "TMP.hpp"
+#include "barrett.hpp"
+#include "constants_and_types.hpp"
+#include "declarations.hpp"
+#include "montgomery.hpp"
+
+/**
+ * @file fixed_base_pow.hpp
+ * @brief Exponentiation of a fixed base with precomputed comb tables
+ *
+ * For an exponent of t bits and h teeth, the exponent is cut into h rows of a = ⌈t/h⌉
+ * bits. The table holds, for every h-bit pattern j, the product of g^(2^(a·i)) over the
+ * set bits i of j. A column of the exponent then costs one table lookup and one
+ * multiplication, and only a squarings are left instead of t (Lim-Lee comb).
+ *
+ * With v tables, the columns are further cut into v blocks of b = ⌈a/v⌉ columns and table
+ * k is the first table raised to 2^(k·b), which leaves b squarings.
+ *
+ * MEMORY/TIME TRADEOFF (t-bit exponents):
+ * - Table entries: v × 2^h numbers of the size of the modulus
+ * - Per exponentiation: ⌈a/v⌉ squarings and at most a multiplications
+ *
+ * USAGE:
+ * ```cpp
+ * const jmaths::fixed_base_pow g_pow(generator, modulus, 256U);  // exponents < 2^256
+ * for (const N & e : exponents) { N y = g_pow.pow(e); }          // generator^e mod modulus
+ * ```
+ *
+ * THREAD SAFETY: An object is immutable after construction and can be shared.
+ */
+
+namespace jmaths {
+
+/**
+ * @class fixed_base_pow
+ * @brief Precomputed comb tables for powers of a fixed base modulo a fixed modulus
+ * @tparam basic_N_type basic_N type of the base, exponents and modulus
+ *
+ * The tables are kept in Montgomery form for odd moduli and reduced with Barrett
+ * reduction for even moduli, as in calc::pow_mod.
+ */
+template <TMP::instance_of<basic_N> basic_N_type> class fixed_base_pow {
+   public:
+    /**
+     * @var default_teeth
+     * @brief Number of rows of the comb if none is given
+     */
+    static constexpr unsigned default_teeth = 6U;
+
+    /**
+     * @var max_teeth
+     * @brief Upper bound for the number of rows (a table has 2^teeth entries)
+     */
+    static constexpr unsigned max_teeth = 16U;
+
+    /**
+     * @brief Precompute the comb tables
+     * @param base The fixed base g (any size, it is reduced modulo mod first)
+     * @param mod The modulus
+     * @param exponent_bits Exponent length t the tables are built for
+     * @param teeth Number of rows h, clamped to [1, max_teeth]
+     * @param tables Number of tables v, clamped to [1, ⌈t/h⌉]
+     * @throws error::division_by_zero if mod is zero
+     *
+     * COMPLEXITY: t squarings and v × 2^h multiplications
+     */
+    constexpr fixed_base_pow(const basic_N_type & base,
+                             const basic_N_type & mod,
+                             bitcount_t exponent_bits,
+                             unsigned teeth = default_teeth,
+                             unsigned tables = 1U);
+
+    /**
+     * @brief The modulus
+     */
+    [[nodiscard]] constexpr const basic_N_type & modulus() const;
+
+    /**
+     * @brief Number of precomputed numbers, v × 2^h
+     */
+    [[nodiscard]] constexpr std::size_t table_entries() const;
+
+    /**
+     * @brief Raise the fixed base to a power
+     * @param exponent The exponent
+     * @return base^exponent mod m
+     *
+     * Exponents longer than the exponent_bits of the constructor are still correct: the
+     * bits above the comb are handled by a generic exponentiation of g^(2^(h·a)).
+     */
+    [[nodiscard]] constexpr basic_N_type pow(const basic_N_type & exponent) const;
+
+   private:
+    std::variant<montgomery_context<basic_N_type>, barrett_context<basic_N_type>> ctx_;
+    bitcount_t rows_;      // h
+    bitcount_t columns_;   // a = ⌈t/h⌉
+    bitcount_t blocks_;    // b = ⌈a/v⌉, columns per table
+    bitcount_t tables_;    // v
+    std::vector<basic_N_type> table_;  // v tables of 2^h entries
+    basic_N_type one_;     // 1 in the representation of the tables
+    basic_N_type top_;     // g^(2^(h·a)) mod m, for longer exponents
+
+    /**
+     * @brief Product in the representation of the tables
+     */
+    [[nodiscard]] constexpr basic_N_type mul_(const basic_N_type & a, const basic_N_type & b) const;
+
+    /**
+     * @brief Convert a number (any size) into the representation of the tables
+     */
+    [[nodiscard]] constexpr basic_N_type to_table_(const basic_N_type & x) const;
+
+    /**
+     * @brief Convert from the representation of the tables back into a number below m
+     */
+    [[nodiscard]] constexpr basic_N_type from_table_(const basic_N_type & x) const;
+};
+
+}  // namespace jmaths
+
+#include "fixed_base_pow_impl.hpp"
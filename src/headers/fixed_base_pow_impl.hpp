@@ -0,0 +1,166 @@
+// The jmaths library for C++
+// Copyright (C) 2025  Jasper de Smaele
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <variant>
+#include <vector>
+
+#include "TMP.hpp"
+#include "barrett.hpp"
+#include "basic_N.hpp"
+#include "constants_and_types.hpp"
+#include "def.hh"
+#include "fixed_base_pow.hpp"
+#include "montgomery.hpp"
+
+// member functions of fixed_base_pow
+namespace jmaths {
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr fixed_base_pow<basic_N_type>::fixed_base_pow(const basic_N_type & base,
+                                                       const basic_N_type & mod,
+                                                       bitcount_t exponent_bits,
+                                                       unsigned teeth,
+                                                       unsigned tables) :
+    ctx_([&mod]() -> decltype(ctx_) {
+        // same choice as calc::pow_mod, a zero modulus is rejected by barrett_context
+        if (mod.is_odd()) { return montgomery_context<basic_N_type>{mod}; }
+        return barrett_context<basic_N_type>{mod};
+    }()),
+    rows_(std::clamp(teeth, 1U, max_teeth)),
+    columns_((std::max(exponent_bits, bitcount_t{1U}) + rows_ - 1U) / rows_),
+    tables_(std::clamp(bitcount_t{tables}, bitcount_t{1U}, columns_)) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    blocks_ = (columns_ + tables_ - 1U) / tables_;
+
+    one_ = to_table_(basic_N_type{1U});
+
+    // g^(2^(a·i + k·b)) for row i and table k, found by squaring up to g^(2^(h·a))
+    std::vector<basic_N_type> powers(rows_ * tables_);
+    basic_N_type power = to_table_(base);
+    for (bitcount_t p = 0U; p < rows_ * columns_; ++p) {
+        const bitcount_t column = p % columns_;
+        if (column % blocks_ == 0U) { powers[p / columns_ * tables_ + column / blocks_] = power; }
+        power = mul_(power, power);
+    }
+    top_ = from_table_(power);
+
+    // entry j of table k is the product of the powers of the rows set in j, built from the
+    // entry without the lowest set bit
+    const std::size_t entries = std::size_t{1U} << rows_;
+    table_.resize(tables_ * entries);
+    for (std::size_t k = 0U; k < tables_; ++k) {
+        const auto table = table_.begin() + static_cast<std::ptrdiff_t>(k * entries);
+        table[0] = one_;
+        for (std::size_t j = 1U; j < entries; ++j) {
+            const auto row = static_cast<std::size_t>(std::countr_zero(j));
+            table[static_cast<std::ptrdiff_t>(j)] =
+                mul_(table[static_cast<std::ptrdiff_t>(j & (j - 1U))], powers[row * tables_ + k]);
+        }
+    }
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr const basic_N_type & fixed_base_pow<basic_N_type>::modulus() const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    return std::visit([](const auto & ctx) -> const basic_N_type & { return ctx.modulus(); },
+                      ctx_);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr std::size_t fixed_base_pow<basic_N_type>::table_entries() const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    return table_.size();
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type fixed_base_pow<basic_N_type>::pow(const basic_N_type & exponent) const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // ALGORITHM: Lim-Lee comb
+    // Bit a·i + k·b + c of the exponent belongs to row i, table k and column c of its
+    // block. Going down the columns c, the result is squared once and multiplied by the
+    // entry of every table that is selected by the bits of the rows in that column.
+
+    const std::size_t entries = std::size_t{1U} << rows_;
+
+    basic_N_type result = one_;
+
+    for (bitcount_t c = blocks_; c-- > 0U;) {
+        if (c + 1U != blocks_) { result = mul_(result, result); }
+
+        for (bitcount_t k = 0U; k < tables_; ++k) {
+            // the last block may be shorter than b
+            const bitcount_t column = k * blocks_ + c;
+            if (column >= columns_) { continue; }
+
+            std::size_t index = 0U;
+            for (bitcount_t i = rows_; i-- > 0U;) {
+                index = index << 1U |
+                        static_cast<std::size_t>(static_cast<bool>(exponent[i * columns_ + column]));
+            }
+
+            if (index != 0U) { result = mul_(result, table_[k * entries + index]); }
+        }
+    }
+
+    // bits above the comb: g^e = g^(e mod 2^(h·a)) × (g^(2^(h·a)))^(e >> h·a)
+    const bitcount_t comb_bits = rows_ * columns_;
+    if (exponent.bits() > comb_bits) {
+        const basic_N_type high = std::visit(
+            [&](const auto & ctx) { return ctx.pow(top_, exponent >> comb_bits); }, ctx_);
+        result = mul_(result, to_table_(high));
+    }
+
+    return from_table_(result);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type fixed_base_pow<basic_N_type>::mul_(const basic_N_type & a,
+                                                          const basic_N_type & b) const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    return std::visit([&](const auto & ctx) { return ctx.mul(a, b); }, ctx_);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type fixed_base_pow<basic_N_type>::to_table_(const basic_N_type & x) const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    if (const auto * const ctx = std::get_if<montgomery_context<basic_N_type>>(&ctx_)) {
+        return ctx->to_montgomery(x);
+    }
+    return std::get<barrett_context<basic_N_type>>(ctx_).reduce(x);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type fixed_base_pow<basic_N_type>::from_table_(const basic_N_type & x) const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    if (const auto * const ctx = std::get_if<montgomery_context<basic_N_type>>(&ctx_)) {
+        return ctx->from_montgomery(x);
+    }
+    return x;
+}
+
+}  // namespace jmaths
@@ -0,0 +1,362 @@
+// The jmaths library for C++
+// Copyright (C) 2025  Jasper de Smaele
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+#include "TMP.hpp"
+#include "basic_N.hpp"
+#include "constants_and_types.hpp"
+#include "def.hh"
+#include "error.hpp"
+#include "montgomery.hpp"
+#include "sliding_window.hpp"
+
+// member functions of montgomery_context
+namespace jmaths {
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr montgomery_context<basic_N_type>::montgomery_context(const basic_N_type & mod) :
+    mod_(mod) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    error::division_by_zero::check(mod_);
+
+    if (mod_.is_even()) {
+        throw error::invalid_modulus("Montgomery reduction needs an odd modulus!");
+    }
+
+    const std::size_t n = limbs();
+
+    one_.resize(n);
+    r2_.resize(n);
+
+    // R mod m and R² mod m, with R = 2^(n × w)
+    load_(one_, reduce_(basic_N_type::one_ << n * base_int_type_bits));
+    load_(r2_, reduce_(basic_N_type::one_ << 2U * n * base_int_type_bits));
+
+    // -m⁻¹ mod 2^w by Newton's iteration: m0 is its own inverse modulo 8 and every
+    // step inv = inv × (2 - m0 × inv) doubles the number of correct low bits
+    const base_int_big_type m0 = mod_.digits_.front();
+    base_int_big_type inv = m0;
+
+    for (bitcount_t correct_bits = 3U; correct_bits < base_int_type_bits; correct_bits *= 2U) {
+        inv = static_cast<base_int_big_type>(
+                  inv * static_cast<base_int_big_type>(2U - m0 * inv)) &
+              basic_N_type::max_digit;
+    }
+
+    m_inv_ = static_cast<limb_type>(basic_N_type::radix - inv);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr auto montgomery_context<basic_N_type>::modulus() const -> const basic_N_type & {
+    JMATHS_FUNCTION_TO_LOG;
+
+    return mod_;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr std::size_t montgomery_context<basic_N_type>::limbs() const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    return mod_.digits_.size();
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type montgomery_context<basic_N_type>::to_montgomery(
+    const basic_N_type & x) const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    limb_vector x_limbs(limbs());
+    limb_vector result(limbs());
+
+    load_(x_limbs, reduce_(x));
+    mul(result, x_limbs, r2_);
+
+    return store_(result);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type montgomery_context<basic_N_type>::from_montgomery(
+    const basic_N_type & x) const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    limb_vector x_limbs(limbs());
+    limb_vector unit(limbs());
+    limb_vector result(limbs());
+
+    load_(x_limbs, x);
+    unit.front() = 1U;
+    mul(result, x_limbs, unit);
+
+    return store_(result);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type montgomery_context<basic_N_type>::mul(const basic_N_type & a,
+                                                             const basic_N_type & b) const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    limb_vector a_limbs(limbs());
+    limb_vector b_limbs(limbs());
+    limb_vector result(limbs());
+
+    load_(a_limbs, a);
+    load_(b_limbs, b);
+    mul(result, a_limbs, b_limbs);
+
+    return store_(result);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr void montgomery_context<basic_N_type>::mul(std::span<limb_type> out,
+                                                     std::span<const limb_type> a,
+                                                     std::span<const limb_type> b) const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // ALGORITHM: CIOS Montgomery multiplication (Koç, Acar and Kaliski, 1996)
+    // The partial result t = (out, t_n, t_n1) is kept below 2m. For every limb b_i:
+    //     t += a × b_i
+    //     q = t_0 × (-m⁻¹) mod 2^w       (so that t + q × m ≡ 0 mod 2^w)
+    //     t = (t + q × m) / 2^w          (the division is a shift by one limb)
+    // After n steps t = a × b × R⁻¹ (mod m) and t < 2m, so at most one subtraction of
+    // m is needed. Every digit operation is (w-bit) + (w-bit)² + (w-bit) < 2^(2w).
+
+    const std::size_t n = limbs();
+    const auto & m = mod_.digits_;
+
+    assert(out.size() == n && a.size() == n && b.size() == n);
+
+    std::ranges::fill(out, limb_type{});
+    limb_type t_n = 0U;
+
+    for (std::size_t i = 0U; i < n; ++i) {
+        const auto b_i = static_cast<base_int_big_type>(b[i]);
+
+        // t += a × b_i
+        base_int_big_type carry = 0U;
+        for (std::size_t j = 0U; j < n; ++j) {
+            const auto sum = static_cast<base_int_big_type>(out[j] + a[j] * b_i + carry);
+            out[j] = static_cast<limb_type>(sum);
+            carry = sum >> base_int_type_bits;
+        }
+
+        auto top = static_cast<base_int_big_type>(t_n + carry);
+        t_n = static_cast<limb_type>(top);
+        const auto t_n1 = static_cast<limb_type>(top >> base_int_type_bits);
+
+        // t = (t + q × m) / 2^w
+        const auto q = static_cast<base_int_big_type>(
+            static_cast<limb_type>(static_cast<base_int_big_type>(out.front()) * m_inv_));
+
+        carry = static_cast<base_int_big_type>(out.front() + q * m.front()) >> base_int_type_bits;
+        for (std::size_t j = 1U; j < n; ++j) {
+            const auto sum = static_cast<base_int_big_type>(out[j] + q * m[j] + carry);
+            out[j - 1U] = static_cast<limb_type>(sum);
+            carry = sum >> base_int_type_bits;
+        }
+
+        top = static_cast<base_int_big_type>(t_n + carry);
+        out[n - 1U] = static_cast<limb_type>(top);
+        t_n = static_cast<limb_type>(t_n1 + (top >> base_int_type_bits));
+    }
+
+    // t < 2m, subtract m once if t >= m
+    // Without branches on the data: the borrow of out - m decides together with t_n, and
+    // m is subtracted under a mask, so pow_ct() runs in constant time
+    limb_type borrow = 0U;
+    for (std::size_t j = 0U; j < n; ++j) {
+        const auto diff = static_cast<base_int_big_type>(
+            static_cast<base_int_big_type>(out[j]) - m[j] - borrow);
+        borrow = static_cast<limb_type>((diff >> base_int_type_bits) != 0U);
+    }
+
+    const auto mask = static_cast<limb_type>(
+        limb_type{} - static_cast<limb_type>((t_n != 0U) | (borrow == 0U)));
+
+    borrow = 0U;
+    for (std::size_t j = 0U; j < n; ++j) {
+        const auto diff = static_cast<base_int_big_type>(
+            static_cast<base_int_big_type>(out[j]) - (m[j] & mask) - borrow);
+        out[j] = static_cast<limb_type>(diff);
+        borrow = static_cast<limb_type>((diff >> base_int_type_bits) != 0U);
+    }
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type montgomery_context<basic_N_type>::pow(const basic_N_type & base,
+                                                             const basic_N_type & exponent) const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    const std::size_t n = limbs();
+
+    limb_vector base_m(n);
+    limb_vector scratch(n);
+
+    load_(scratch, reduce_(base));
+    mul(base_m, scratch, r2_);
+
+    limb_vector result = internal::sliding_window_pow(
+        base_m,
+        exponent,
+        one_,
+        [&](limb_vector & x) {
+            mul(scratch, x, x);
+            x.swap(scratch);
+        },
+        [&](limb_vector & x, const limb_vector & y) {
+            mul(scratch, x, y);
+            x.swap(scratch);
+        });
+
+    // leave Montgomery form: multiply by the plain number 1
+    std::ranges::fill(base_m, limb_type{});
+    base_m.front() = 1U;
+    mul(scratch, result, base_m);
+
+    return store_(scratch);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type montgomery_context<basic_N_type>::pow_ct(const basic_N_type & base,
+                                                                const basic_N_type & exponent,
+                                                                bitcount_t exponent_bits) const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // ALGORITHM: Fixed-window exponentiation with a uniform operation sequence
+    // The exponent is split into windows of the same width w from the top, padded to
+    // exponent_bits. Every window costs exactly w squarings, one masked scan of the
+    // whole table and one multiplication (by table[0] = 1 for a zero window), like the
+    // fixed square-and-multiply pattern of a Montgomery ladder. Together with the
+    // branch-free final subtraction of mul(), neither the sequence of operations nor
+    // the memory access pattern depends on the exponent value.
+
+    const std::size_t n = limbs();
+
+    const bitcount_t bits = std::max({exponent_bits == 0U ? mod_.bits() : exponent_bits,
+                                      exponent.bits(),
+                                      bitcount_t{1U}});
+
+    // a fixed window needs all 2^w powers, so the window is narrower than for pow()
+    const unsigned window = std::min(internal::sliding_window_bits(bits), 5U);
+    const std::size_t table_size = std::size_t{1U} << window;
+    const bitcount_t windows = (bits + window - 1U) / window;
+
+    limb_vector scratch(n);
+    limb_vector base_m(n);
+
+    load_(scratch, reduce_(base));
+    mul(base_m, scratch, r2_);
+
+    // table[i] = base^i in Montgomery form, stored contiguously
+    limb_vector table(table_size * n);
+    std::ranges::copy(one_, table.begin());
+    for (std::size_t i = 1U; i < table_size; ++i) {
+        mul(std::span(table).subspan(i * n, n),
+            std::span<const limb_type>(table).subspan((i - 1U) * n, n),
+            base_m);
+    }
+
+    // value of the window starting at bit position low
+    const auto window_value = [&](bitcount_t low) {
+        std::size_t value = 0U;
+        for (bitcount_t i = low + window; i-- > low;) {
+            value = value << 1U | static_cast<std::size_t>(static_cast<bool>(exponent[i]));
+        }
+        return value;
+    };
+
+    limb_vector result(n);
+    limb_vector factor(n);
+
+    select_(result, table, window_value((windows - 1U) * window));
+
+    for (bitcount_t w = windows - 1U; w-- > 0U;) {
+        for (unsigned i = 0U; i < window; ++i) {
+            mul(scratch, result, result);
+            result.swap(scratch);
+        }
+
+        select_(factor, table, window_value(w * window));
+        mul(scratch, result, factor);
+        result.swap(scratch);
+    }
+
+    // leave Montgomery form: multiply by the plain number 1
+    std::ranges::fill(factor, limb_type{});
+    factor.front() = 1U;
+    mul(scratch, result, factor);
+
+    return store_(scratch);
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr void montgomery_context<basic_N_type>::select_(std::span<limb_type> out,
+                                                         std::span<const limb_type> table,
+                                                         std::size_t index) const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // every entry is read and combined under a mask, so the access pattern is the same
+    // for every index
+    const std::size_t n = out.size();
+
+    std::ranges::fill(out, limb_type{});
+
+    for (std::size_t i = 0U; i < table.size() / n; ++i) {
+        const auto mask = static_cast<limb_type>(limb_type{} - static_cast<limb_type>(i == index));
+        for (std::size_t j = 0U; j < n; ++j) {
+            out[j] = static_cast<limb_type>(out[j] | (table[i * n + j] & mask));
+        }
+    }
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr void montgomery_context<basic_N_type>::load_(std::span<limb_type> out,
+                                                       const basic_N_type & x) const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    assert(x.digits_.size() <= out.size());
+
+    std::ranges::fill(std::ranges::copy(x.digits_, out.begin()).out, out.end(), limb_type{});
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type montgomery_context<basic_N_type>::store_(
+    std::span<const limb_type> limbs) const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    basic_N_type result;
+    result.digits_.assign(limbs.begin(), limbs.end());
+    result.remove_leading_zeroes_();
+
+    return result;
+}
+
+template <TMP::instance_of<basic_N> basic_N_type>
+constexpr basic_N_type montgomery_context<basic_N_type>::reduce_(const basic_N_type & x) const {
+    JMATHS_FUNCTION_TO_LOG;
+
+    if (basic_N_type::detail::opr_comp(x, mod_) < 0) { return x; }
+    return basic_N_type::detail::opr_div(x, mod_).second;
+}
+
+}  // namespace jmaths
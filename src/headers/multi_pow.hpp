@@ -0,0 +1,99 @@
+// The jmaths library for C++
+// Copyright (C) 2025  Jasper de Smaele
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+#include "TMP.hpp"
+#include "constants_and_types.hpp"
+#include "declarations.hpp"
+
+/**
+ * @file multi_pow.hpp
+ * @brief Multi-exponentiation b_0^e_0 × ... × b_(k-1)^e_(k-1) used by calc::multi_pow_mod
+ *
+ * Computing the powers one by one costs about t squarings for each of the k terms (t =
+ * exponent length). Both methods below share the squarings between all terms:
+ *
+ * - Straus (interleaved sliding windows): every base gets its own table of odd powers and
+ *   its own windows, and the products of all bases are merged into one chain of t
+ *   squarings. About t + Σ (t / (w + 1) + 2^(w-1)) multiplications.
+ * - Pippenger (bucket method): the exponents are cut into c-bit digits. For every digit
+ *   position, each base is multiplied into the bucket of its digit d, and Π B_d^d is
+ *   formed with 2 × 2^c multiplications by running products. About t + (t / c) ×
+ *   (k + 2^(c+1)) multiplications, so the cost per term drops as k grows.
+ *
+ * multi_pow() estimates both costs and uses the cheaper method: Straus for small batches
+ * and Pippenger for large ones.
+ */
+
+namespace jmaths::internal {
+
+/**
+ * @brief Multi-exponentiation over an arbitrary multiplication
+ * @tparam T Type of the elements (a number, or a number in Montgomery form)
+ * @param bases The bases
+ * @param exponents The exponents, one for every base
+ * @param one The identity element, returned if all exponents are zero
+ * @param sqr In-place squaring: sqr(T & x) sets x = x × x
+ * @param mul In-place product: mul(T & x, const T & y) sets x = x × y
+ * @return Π bases[i]^exponents[i] in the domain of sqr and mul
+ */
+template <typename T,
+          TMP::instance_of<basic_N> basic_N_type,
+          typename sqr_type,
+          typename mul_type>
+[[nodiscard]] constexpr T multi_pow(std::span<const T> bases,
+                                    std::span<const basic_N_type> exponents,
+                                    T one,
+                                    sqr_type && sqr,
+                                    mul_type && mul);
+
+/**
+ * @brief Multi-exponentiation with interleaved sliding windows (Straus)
+ * Same parameters as multi_pow()
+ */
+template <typename T,
+          TMP::instance_of<basic_N> basic_N_type,
+          typename sqr_type,
+          typename mul_type>
+[[nodiscard]] constexpr T straus_pow(std::span<const T> bases,
+                                     std::span<const basic_N_type> exponents,
+                                     T one,
+                                     sqr_type && sqr,
+                                     mul_type && mul);
+
+/**
+ * @brief Multi-exponentiation with buckets for c-bit digits (Pippenger)
+ * @param digit_bits Digit size c in [1, 16]
+ * Other parameters as for multi_pow()
+ */
+template <typename T,
+          TMP::instance_of<basic_N> basic_N_type,
+          typename sqr_type,
+          typename mul_type>
+[[nodiscard]] constexpr T pippenger_pow(std::span<const T> bases,
+                                        std::span<const basic_N_type> exponents,
+                                        unsigned digit_bits,
+                                        T one,
+                                        sqr_type && sqr,
+                                        mul_type && mul);
+
+}  // namespace jmaths::internal
+
+#include "multi_pow_impl.hpp"
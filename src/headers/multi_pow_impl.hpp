@@ -0,0 +1,261 @@
+// The jmaths library for C++
+// Copyright (C) 2025  Jasper de Smaele
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "TMP.hpp"
+#include "basic_N.hpp"
+#include "constants_and_types.hpp"
+#include "def.hh"
+#include "multi_pow.hpp"
+#include "sliding_window.hpp"
+
+// multi-exponentiation
+namespace jmaths::internal {
+
+template <typename T,
+          TMP::instance_of<basic_N> basic_N_type,
+          typename sqr_type,
+          typename mul_type>
+constexpr T multi_pow(std::span<const T> bases,
+                      std::span<const basic_N_type> exponents,
+                      T one,
+                      sqr_type && sqr,
+                      mul_type && mul) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    assert(bases.size() == exponents.size());
+
+    bitcount_t exponent_bits = 0U;
+    for (const auto & exponent : exponents) {
+        exponent_bits = std::max(exponent_bits, exponent.bits());
+    }
+
+    if (exponent_bits == 0U) { return one; }
+
+    // estimated multiplications without the t shared squarings
+    bitcount_t straus_cost = 0U;
+    for (const auto & exponent : exponents) {
+        const unsigned window = sliding_window_bits(exponent.bits());
+        straus_cost += exponent.bits() / (window + 1U) + (bitcount_t{1U} << (window - 1U));
+    }
+
+    unsigned digit_bits = 1U;
+    bitcount_t pippenger_cost = straus_cost;
+    for (unsigned c = 1U; c <= 16U; ++c) {
+        const bitcount_t cost =
+            (exponent_bits + c - 1U) / c * (bases.size() + (bitcount_t{1U} << (c + 1U)));
+        if (cost < pippenger_cost) {
+            pippenger_cost = cost;
+            digit_bits = c;
+        }
+    }
+
+    if (pippenger_cost < straus_cost) {
+        return pippenger_pow(bases, exponents, digit_bits, std::move(one), sqr, mul);
+    }
+    return straus_pow(bases, exponents, std::move(one), sqr, mul);
+}
+
+template <typename T,
+          TMP::instance_of<basic_N> basic_N_type,
+          typename sqr_type,
+          typename mul_type>
+constexpr T straus_pow(std::span<const T> bases,
+                       std::span<const basic_N_type> exponents,
+                       T one,
+                       sqr_type && sqr,
+                       mul_type && mul) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    assert(bases.size() == exponents.size());
+
+    const std::size_t terms = bases.size();
+
+    // odd_powers[i][j] = bases[i]^(2j + 1), and digits[i][low] is the odd value of the
+    // window of exponents[i] whose lowest bit is low (0 if no window ends there)
+    std::vector<std::vector<T>> odd_powers(terms);
+    std::vector<std::vector<std::size_t>> digits(terms);
+
+    bitcount_t exponent_bits = 0U;
+
+    for (std::size_t i = 0U; i < terms; ++i) {
+        const auto & exponent = exponents[i];
+        const bitcount_t bits = exponent.bits();
+        if (bits == 0U) { continue; }
+
+        exponent_bits = std::max(exponent_bits, bits);
+
+        const unsigned window = sliding_window_bits(bits);
+        digits[i].resize(bits);
+
+        std::size_t largest = 1U;
+        for (bitcount_t high = bits; high-- > 0U;) {
+            if (!exponent[high]) { continue; }
+
+            bitcount_t low = high + 1U > window ? high + 1U - window : 0U;
+            while (!exponent[low]) { ++low; }
+
+            std::size_t value = 0U;
+            for (bitcount_t j = high + 1U; j-- > low;) {
+                value = value << 1U | static_cast<std::size_t>(static_cast<bool>(exponent[j]));
+            }
+
+            digits[i][low] = value;
+            largest = std::max(largest, value);
+            high = low;
+        }
+
+        // only the odd powers that are used
+        auto & table = odd_powers[i];
+        table.reserve(largest / 2U + 1U);
+        table.push_back(bases[i]);
+
+        if (largest > 1U) {
+            T base_squared = bases[i];
+            sqr(base_squared);
+
+            while (table.size() <= largest / 2U) {
+                T next = table.back();
+                mul(next, base_squared);
+                table.push_back(std::move(next));
+            }
+        }
+    }
+
+    T result = std::move(one);
+    bool started = false;
+
+    for (bitcount_t pos = exponent_bits; pos-- > 0U;) {
+        if (started) { sqr(result); }
+
+        for (std::size_t i = 0U; i < terms; ++i) {
+            if (pos >= digits[i].size() || digits[i][pos] == 0U) { continue; }
+
+            const T & factor = odd_powers[i][digits[i][pos] >> 1U];
+            if (started) {
+                mul(result, factor);
+            } else {
+                result = factor;
+                started = true;
+            }
+        }
+    }
+
+    return result;
+}
+
+template <typename T,
+          TMP::instance_of<basic_N> basic_N_type,
+          typename sqr_type,
+          typename mul_type>
+constexpr T pippenger_pow(std::span<const T> bases,
+                          std::span<const basic_N_type> exponents,
+                          unsigned digit_bits,
+                          T one,
+                          sqr_type && sqr,
+                          mul_type && mul) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    assert(bases.size() == exponents.size());
+    assert(digit_bits >= 1U && digit_bits <= 16U);
+
+    bitcount_t exponent_bits = 0U;
+    for (const auto & exponent : exponents) {
+        exponent_bits = std::max(exponent_bits, exponent.bits());
+    }
+
+    const bitcount_t positions = (exponent_bits + digit_bits - 1U) / digit_bits;
+
+    // buckets[d - 1] is the product of the bases with digit d at the current position
+    std::vector<T> buckets((std::size_t{1U} << digit_bits) - 1U);
+    std::vector<bool> filled(buckets.size());
+
+    T result = std::move(one);
+    bool started = false;
+
+    for (bitcount_t position = positions; position-- > 0U;) {
+        if (started) {
+            for (unsigned i = 0U; i < digit_bits; ++i) { sqr(result); }
+        }
+
+        filled.assign(filled.size(), false);
+
+        for (std::size_t i = 0U; i < bases.size(); ++i) {
+            std::size_t digit = 0U;
+            for (bitcount_t j = digit_bits; j-- > 0U;) {
+                digit = digit << 1U |
+                        static_cast<std::size_t>(
+                            static_cast<bool>(exponents[i][position * digit_bits + j]));
+            }
+            if (digit == 0U) { continue; }
+
+            if (filled[digit - 1U]) {
+                mul(buckets[digit - 1U], bases[i]);
+            } else {
+                buckets[digit - 1U] = bases[i];
+                filled[digit - 1U] = true;
+            }
+        }
+
+        // Π B_d^d = Π_d (B_d × B_(d+1) × ... × B_max): the running product over the
+        // buckets from the top is multiplied into the sum once for every d
+        T running;
+        T sum;
+        bool running_set = false;
+        bool sum_set = false;
+
+        for (std::size_t d = buckets.size(); d-- > 0U;) {
+            if (filled[d]) {
+                if (running_set) {
+                    mul(running, buckets[d]);
+                } else {
+                    running = buckets[d];
+                    running_set = true;
+                }
+            }
+
+            if (!running_set) { continue; }
+
+            if (sum_set) {
+                mul(sum, running);
+            } else {
+                sum = running;
+                sum_set = true;
+            }
+        }
+
+        if (!sum_set) { continue; }
+
+        if (started) {
+            mul(result, sum);
+        } else {
+            result = std::move(sum);
+            started = true;
+        }
+    }
+
+    return result;
+}
+
+}  // namespace jmaths::internal
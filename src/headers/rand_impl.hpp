@@ -55,7 +55,7 @@ template <typename T> T rand_gen<T>::operator()() {
     update_();
 #endif
 
-    return distrib_(gen_);
+    return static_cast<T>(distrib_(gen_));  // the range of distrib_ is within T
 }
 
 template <typename T> void rand_gen<T>::update_() {
@@ -0,0 +1,66 @@
+// The jmaths library for C++
+// Copyright (C) 2025  Jasper de Smaele
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "TMP.hpp"
+#include "constants_and_types.hpp"
+#include "declarations.hpp"
+
+/**
+ * @file sliding_window.hpp
+ * @brief Sliding-window exponentiation shared by calc::pow, montgomery_context and
+ * barrett_context
+ *
+ * The exponent is scanned from the most significant bit. Runs of zero bits cost one
+ * squaring each; every other window of up to w bits starts and ends with a 1 bit, so its
+ * value is odd and one multiplication by a precomputed odd power base^1, base^3, ...,
+ * base^(2^w - 1) replaces up to w multiplications by the base.
+ *
+ * For an e-bit exponent this needs about e squarings and e / (w + 1) multiplications,
+ * against e / 2 multiplications for binary exponentiation, at the cost of 2^(w-1) - 1
+ * table multiplications.
+ */
+
+namespace jmaths::internal {
+
+/**
+ * @brief Window size for an exponent of the given bit length
+ * @return w in [1, 7], chosen so that the table cost 2^(w-1) stays below the
+ * multiplications it saves
+ */
+[[nodiscard]] constexpr unsigned sliding_window_bits(bitcount_t exponent_bits);
+
+/**
+ * @brief Sliding-window exponentiation over an arbitrary multiplication
+ * @tparam T Type of the elements (a number, or limbs in Montgomery form)
+ * @param base The base
+ * @param exponent The exponent
+ * @param one The identity element, returned for a zero exponent
+ * @param sqr In-place squaring: sqr(T & x) sets x = x × x
+ * @param mul In-place product: mul(T & x, const T & y) sets x = x × y
+ * @return base^exponent in the domain of sqr and mul
+ */
+template <typename T,
+          TMP::instance_of<basic_N> basic_N_type,
+          typename sqr_type,
+          typename mul_type>
+[[nodiscard]] constexpr T sliding_window_pow(
+    const T & base, const basic_N_type & exponent, T one, sqr_type && sqr, mul_type && mul);
+
+}  // namespace jmaths::internal
+
+#include "sliding_window_impl.hpp"
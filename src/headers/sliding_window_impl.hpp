@@ -0,0 +1,111 @@
+// The jmaths library for C++
+// Copyright (C) 2025  Jasper de Smaele
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "TMP.hpp"
+#include "basic_N.hpp"
+#include "constants_and_types.hpp"
+#include "def.hh"
+#include "sliding_window.hpp"
+
+// sliding-window exponentiation
+namespace jmaths::internal {
+
+constexpr unsigned sliding_window_bits(bitcount_t exponent_bits) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    // largest exponent length for which window size i + 1 is still the best choice,
+    // e.g. 5-bit windows up to 672 exponent bits (cf. HAC, Table 14.16)
+    constexpr std::array<bitcount_t, 6U> thresholds{8U, 24U, 80U, 240U, 672U, 1792U};
+
+    unsigned window = 1U;
+    for (const auto threshold : thresholds) {
+        if (exponent_bits <= threshold) { break; }
+        ++window;
+    }
+
+    return window;
+}
+
+template <typename T,
+          TMP::instance_of<basic_N> basic_N_type,
+          typename sqr_type,
+          typename mul_type>
+constexpr T sliding_window_pow(
+    const T & base, const basic_N_type & exponent, T one, sqr_type && sqr, mul_type && mul) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    const bitcount_t exponent_bits = exponent.bits();
+    if (exponent_bits == 0U) { return one; }
+
+    const unsigned window = sliding_window_bits(exponent_bits);
+
+    // odd_powers[i] = base^(2i + 1)
+    const std::size_t table_size = std::size_t{1U} << (window - 1U);
+    std::vector<T> odd_powers;
+    odd_powers.reserve(table_size);
+    odd_powers.push_back(base);
+
+    if (table_size > 1U) {
+        T base_squared = base;
+        sqr(base_squared);
+
+        while (odd_powers.size() < table_size) {
+            T next = odd_powers.back();
+            mul(next, base_squared);
+            odd_powers.push_back(std::move(next));
+        }
+    }
+
+    T result = std::move(one);
+    bool started = false;
+
+    // bits [low, high] form the current window, high is always a 1 bit
+    for (bitcount_t high = exponent_bits; high-- > 0U;) {
+        if (!exponent[high]) {
+            if (started) { sqr(result); }
+            continue;
+        }
+
+        bitcount_t low = high + 1U > window ? high + 1U - window : 0U;
+        while (!exponent[low]) { ++low; }
+
+        std::size_t value = 0U;
+        for (bitcount_t i = high + 1U; i-- > low;) {
+            value = value << 1U | static_cast<std::size_t>(static_cast<bool>(exponent[i]));
+        }
+
+        if (started) {
+            for (bitcount_t i = low; i <= high; ++i) { sqr(result); }
+            mul(result, odd_powers[value >> 1U]);
+        } else {
+            result = odd_powers[value >> 1U];
+            started = true;
+        }
+
+        high = low;
+    }
+
+    return result;
+}
+
+}  // namespace jmaths::internal
@@ -0,0 +1,154 @@
+// The jmaths library for C++
+// Copyright (C) 2025  Jasper de Smaele
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "constants_and_types.hpp"
+
+/**
+ * @file tracking_allocator.hpp
+ * @brief Counting allocator and allocation statistics
+ *
+ * tracking_allocator can be plugged into the Allocator slot of basic_N, basic_Z and
+ * basic_Q. It forwards to jmaths::allocator and records every allocation in a set of
+ * process-wide counters, which can be read with get_allocation_stats().
+ *
+ * USAGE:
+ * ```cpp
+ * using tracked_N = jmaths::basic_N<std::uint32_t, std::uint64_t,
+ *                                   jmaths::tracking_allocator<std::uint32_t>>;
+ *
+ * jmaths::reset_allocation_stats();
+ * run_workload<tracked_N>();
+ * const auto stats = jmaths::get_allocation_stats();
+ * // stats.allocations, stats.peak_live_bytes, stats.limb_histogram, ...
+ * ```
+ *
+ * THREAD SAFETY: The counters are atomics updated with relaxed ordering, so they can
+ * be used from several threads. A snapshot is not taken atomically as a whole.
+ *
+ * CONSTANT EVALUATION: Allocations made during constant evaluation are not counted.
+ */
+
+namespace jmaths {
+
+/**
+ * @struct allocation_stats
+ * @brief Snapshot of the counters maintained by tracking_allocator
+ */
+struct allocation_stats {
+    /**
+     * @var histogram_buckets
+     * @brief Number of buckets in limb_histogram
+     */
+    static constexpr std::size_t histogram_buckets = std::numeric_limits<std::size_t>::digits + 1U;
+
+    std::uint64_t allocations = 0U;        ///< Number of calls to allocate()
+    std::uint64_t deallocations = 0U;      ///< Number of calls to deallocate()
+    std::uint64_t bytes_allocated = 0U;    ///< Total bytes requested by allocate()
+    std::uint64_t bytes_deallocated = 0U;  ///< Total bytes released by deallocate()
+    std::uint64_t live_bytes = 0U;         ///< Bytes currently allocated
+    std::uint64_t peak_live_bytes = 0U;    ///< Maximum of live_bytes since the last reset
+
+    /**
+     * @brief Allocations by limb count in power of 2 buckets
+     * Bucket i counts the allocations of n limbs with std::bit_width(n) == i,
+     * i.e. bucket 0 holds n == 0 and bucket i > 0 holds 2^(i-1) <= n < 2^i
+     */
+    std::array<std::uint64_t, histogram_buckets> limb_histogram{};
+};
+
+/**
+ * @brief Read the current allocation counters
+ * @return Snapshot of all counters
+ */
+[[nodiscard]] inline allocation_stats get_allocation_stats();
+
+/**
+ * @brief Reset the allocation counters
+ * All counters are cleared except live_bytes; peak_live_bytes restarts at live_bytes
+ */
+inline void reset_allocation_stats();
+
+/**
+ * @class tracking_allocator
+ * @brief Allocator that counts allocations before forwarding to jmaths::allocator
+ * @tparam T Type of the allocated elements (the limb type for basic_N)
+ *
+ * DESIGN: Stateless, so all instances compare equal and containers can exchange
+ * buffers freely; the statistics live in process-wide counters
+ */
+template <typename T> class tracking_allocator {
+   public:
+    using value_type = T;
+
+    constexpr tracking_allocator() noexcept = default;
+
+    template <typename U> constexpr tracking_allocator(const tracking_allocator<U> &) noexcept;
+
+    /**
+     * @brief Allocate storage for n elements and record the allocation
+     * @param n Number of elements
+     * @return Pointer to the allocated storage
+     */
+    [[nodiscard]] constexpr T * allocate(std::size_t n);
+
+    /**
+     * @brief Release storage for n elements and record the deallocation
+     * @param ptr Pointer returned by allocate(n)
+     * @param n Number of elements passed to allocate()
+     */
+    constexpr void deallocate(T * ptr, std::size_t n);
+
+    template <typename U>
+    [[nodiscard]] friend constexpr bool operator==(const tracking_allocator &,
+                                                   const tracking_allocator<U> &) noexcept {
+        return true;
+    }
+};
+
+}  // namespace jmaths
+
+namespace jmaths::internal {
+
+/**
+ * @struct allocation_counters
+ * @brief Process-wide counters behind allocation_stats
+ */
+struct allocation_counters {
+    std::atomic<std::uint64_t> allocations;
+    std::atomic<std::uint64_t> deallocations;
+    std::atomic<std::uint64_t> bytes_allocated;
+    std::atomic<std::uint64_t> bytes_deallocated;
+    std::atomic<std::uint64_t> live_bytes;
+    std::atomic<std::uint64_t> peak_live_bytes;
+    std::array<std::atomic<std::uint64_t>, allocation_stats::histogram_buckets> limb_histogram;
+
+    void record_allocation(std::size_t count, std::size_t bytes);
+    void record_deallocation(std::size_t bytes);
+};
+
+inline constinit allocation_counters global_allocation_counters{};
+
+}  // namespace jmaths::internal
+
+#include "tracking_allocator_impl.hpp"
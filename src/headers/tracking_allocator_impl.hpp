@@ -0,0 +1,127 @@
+// The jmaths library for C++
+// Copyright (C) 2025  Jasper de Smaele
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#include "constants_and_types.hpp"
+#include "def.hh"
+#include "tracking_allocator.hpp"
+
+// member functions of allocation_counters
+namespace jmaths::internal {
+
+inline void allocation_counters::record_allocation(std::size_t count, std::size_t bytes) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    allocations.fetch_add(1U, std::memory_order_relaxed);
+    bytes_allocated.fetch_add(bytes, std::memory_order_relaxed);
+    limb_histogram[static_cast<std::size_t>(std::bit_width(count))].fetch_add(
+        1U, std::memory_order_relaxed);
+
+    const std::uint64_t live = live_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+
+    // raise the peak unless another thread has already raised it further
+    std::uint64_t peak = peak_live_bytes.load(std::memory_order_relaxed);
+    while (peak < live &&
+           !peak_live_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+}
+
+inline void allocation_counters::record_deallocation(std::size_t bytes) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    deallocations.fetch_add(1U, std::memory_order_relaxed);
+    bytes_deallocated.fetch_add(bytes, std::memory_order_relaxed);
+    live_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+}  // namespace jmaths::internal
+
+// functions to access the allocation statistics
+namespace jmaths {
+
+inline allocation_stats get_allocation_stats() {
+    JMATHS_FUNCTION_TO_LOG;
+
+    const auto & counters = internal::global_allocation_counters;
+
+    allocation_stats stats;
+
+    stats.allocations = counters.allocations.load(std::memory_order_relaxed);
+    stats.deallocations = counters.deallocations.load(std::memory_order_relaxed);
+    stats.bytes_allocated = counters.bytes_allocated.load(std::memory_order_relaxed);
+    stats.bytes_deallocated = counters.bytes_deallocated.load(std::memory_order_relaxed);
+    stats.live_bytes = counters.live_bytes.load(std::memory_order_relaxed);
+    stats.peak_live_bytes = counters.peak_live_bytes.load(std::memory_order_relaxed);
+
+    for (std::size_t i = 0U; i < allocation_stats::histogram_buckets; ++i) {
+        stats.limb_histogram[i] = counters.limb_histogram[i].load(std::memory_order_relaxed);
+    }
+
+    return stats;
+}
+
+inline void reset_allocation_stats() {
+    JMATHS_FUNCTION_TO_LOG;
+
+    auto & counters = internal::global_allocation_counters;
+
+    counters.allocations.store(0U, std::memory_order_relaxed);
+    counters.deallocations.store(0U, std::memory_order_relaxed);
+    counters.bytes_allocated.store(0U, std::memory_order_relaxed);
+    counters.bytes_deallocated.store(0U, std::memory_order_relaxed);
+
+    // live storage is still owned by existing numbers, so only the peak restarts
+    counters.peak_live_bytes.store(counters.live_bytes.load(std::memory_order_relaxed),
+                                   std::memory_order_relaxed);
+
+    for (auto & bucket : counters.limb_histogram) {
+        bucket.store(0U, std::memory_order_relaxed);
+    }
+}
+
+}  // namespace jmaths
+
+// member functions of tracking_allocator
+namespace jmaths {
+
+template <typename T>
+template <typename U>
+constexpr tracking_allocator<T>::tracking_allocator(const tracking_allocator<U> &) noexcept {}
+
+template <typename T> constexpr T * tracking_allocator<T>::allocate(std::size_t n) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    T * const ptr = allocator<T>{}.allocate(n);
+
+    if !consteval { internal::global_allocation_counters.record_allocation(n, n * sizeof(T)); }
+
+    return ptr;
+}
+
+template <typename T> constexpr void tracking_allocator<T>::deallocate(T * ptr, std::size_t n) {
+    JMATHS_FUNCTION_TO_LOG;
+
+    if !consteval { internal::global_allocation_counters.record_deallocation(n * sizeof(T)); }
+
+    allocator<T>{}.deallocate(ptr, n);
+}
+
+}  // namespace jmaths
@@ -0,0 +1,91 @@
+// The jmaths library for C++
+// Copyright (C) 2025  Jasper de Smaele
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <boost/test/unit_test.hpp>
+#include <cstdint>
+
+#include "all.hpp"
+
+using namespace jmaths;
+
+BOOST_AUTO_TEST_SUITE(barrett_tests)
+
+BOOST_AUTO_TEST_CASE(reduce_below_square) {
+    const N m("340282366920938463463374607431768211456000");  // even
+    const barrett_context ctx(m);
+
+    BOOST_TEST(ctx.modulus() == m);
+
+    const N largest = (m - N(1)) * (m - N(1));
+    BOOST_TEST(ctx.reduce(largest) == (largest / m).second);
+    BOOST_TEST(ctx.reduce(m) == 0);
+    BOOST_TEST(ctx.reduce(m - N(1)) == m - N(1));
+    BOOST_TEST(ctx.reduce(m * N(12345) + N(678)) == 678);
+}
+
+BOOST_AUTO_TEST_CASE(reduce_above_square) {
+    const N m("123456789012345678901234567890");
+    const barrett_context ctx(m);
+
+    const N x = (m * m) << 100U;
+    BOOST_TEST(ctx.reduce(x + N(17)) == ((x + N(17)) / m).second);
+}
+
+BOOST_AUTO_TEST_CASE(mul_and_pow) {
+    const N m = N(1) << 200U;
+    const barrett_context ctx(m);
+
+    const N a("98765432109876543210987654321098765432109876543210");
+    const N b("12345678901234567890123456789012345678901234567890");
+
+    BOOST_TEST(ctx.mul(a, b) == (a * b / m).second);
+
+    // 3 has order 2^198 modulo 2^200
+    BOOST_TEST(ctx.pow(N(3), N(1) << 198U) == 1);
+    BOOST_TEST(ctx.pow(N(3), N(1) << 197U) != 1);
+    BOOST_TEST(calc::pow_mod(N(3), N(1) << 198U, m) == 1);
+}
+
+BOOST_AUTO_TEST_CASE(pow_mod_even_moduli) {
+    const N base("31415926535897932384626433832795028841971693993751058209749445923");
+    const N exponent("2718281828459045235360287471352662497757");
+
+    for (const N & m : {N(2), N(1000), N("1000000000000000000000000000000000000000000")}) {
+        N expected(1);
+        N b = (base / m).second;
+        for (bitcount_t i = 0U; i < exponent.bits(); ++i) {
+            if (exponent[i]) { expected = (expected * b / m).second; }
+            b = (b * b / m).second;
+        }
+
+        BOOST_TEST(calc::pow_mod(base, exponent, m) == expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(small_limbs) {
+    using N8 = basic_N<std::uint8_t, std::uint16_t>;
+
+    const barrett_context ctx(N8(1000000));
+    BOOST_TEST(ctx.reduce(N8("999999999999")) == 999999);
+    BOOST_TEST(ctx.pow(N8(7), N8(4)) == 2401);
+    BOOST_TEST(barrett_context(N8(1)).pow(N8(5), N8(3)) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(zero_modulus) {
+    BOOST_CHECK_THROW(barrett_context(N(0)), error::division_by_zero);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -168,6 +168,24 @@ BOOST_AUTO_TEST_CASE(division_by_one) {
     BOOST_TEST(remainder == 0);
 }
 
+BOOST_AUTO_TEST_CASE(division_multi_digit_divisor) {
+    const N divisor("340282366920938463463374607431768211455");  // 2^128 - 1, all ones
+    const N quotient("123456789012345678901234567890123456789");
+    const N remainder = divisor - N(1);
+    const N dividend = quotient * divisor + remainder;
+
+    auto [q, r] = dividend / divisor;
+    BOOST_TEST(q == quotient);
+    BOOST_TEST(r == remainder);
+
+    // the quotient estimate from the leading digits needs a correction here
+    const N a("18446744073709551615000000000000000000000000000000");
+    const N b("18446744073709551616000000000000000001");
+    auto [q2, r2] = a / b;
+    BOOST_TEST(q2 * b + r2 == a);
+    BOOST_TEST(r2 < b);
+}
+
 BOOST_AUTO_TEST_CASE(division_by_zero_throws) {
     N a(42);
     N zero(0);
@@ -355,4 +373,100 @@ BOOST_AUTO_TEST_CASE(constructor_from_various_types) {
     BOOST_TEST(from_ulonglong == 123456789ULL);
 }
 
+BOOST_AUTO_TEST_CASE(fused_kernels) {
+    const N a("123456789012345678901234567890");
+    const N b("98765432109876543210");
+    const N c("5555555555555555555555");
+
+    N x = c;
+    x.addmul(a, b);
+    BOOST_TEST(x == c + a * b);
+
+    x.submul(a, b);
+    BOOST_TEST(x == c);
+
+    // like operator-=, submul yields the absolute difference
+    x.submul(a, b);
+    BOOST_TEST(x == a * b - c);
+
+    x = c;
+    x.addmul(a, 1000U).submul(b, 7U);
+    BOOST_TEST(x == c + a * N(1000) - b * N(7));
+
+    x = a;
+    x.mul_limb(12345U).add_limb(67U);
+    BOOST_TEST(x == a * N(12345) + N(67));
+
+    x = c;
+    x.fma_2exp(a, b, 75U);
+    BOOST_TEST(x == c + ((a * b) << 75U));
+}
+
+BOOST_AUTO_TEST_CASE(fused_kernels_aliasing) {
+    const N a("123456789012345678901234567890");
+
+    N x = a;
+    x.addmul(x, x);
+    BOOST_TEST(x == a + a * a);
+
+    x = a;
+    x *= x;
+    BOOST_TEST(x == a * a);
+
+    x = a;
+    x.addmul(x, 3U);
+    BOOST_TEST(x == a * N(4));
+}
+
+BOOST_AUTO_TEST_CASE(add_limb_carry) {
+    N x("340282366920938463463374607431768211455");  // 2^128 - 1
+    x.add_limb(1U);
+    BOOST_TEST(x == N("340282366920938463463374607431768211456"));
+
+    N zero;
+    zero.add_limb(5U);
+    BOOST_TEST(zero == 5);
+
+    x.mul_limb(0U);
+    BOOST_TEST(x.is_zero());
+}
+
+BOOST_AUTO_TEST_CASE(capacity_management) {
+    N acc;
+    acc.reserve(1000U);
+    const bitcount_t reserved = acc.capacity();
+    BOOST_TEST(reserved >= 1000U);
+    BOOST_TEST(acc.is_zero());
+
+    const N value("123456789012345678901234567890");
+    acc = value;
+    acc.addmul(value, value);
+    acc *= value;
+    acc.set_zero();
+    BOOST_TEST(acc.capacity() == reserved);
+
+    acc = value;
+    acc.shrink_to_fit();
+    BOOST_TEST(acc == value);
+    BOOST_TEST(acc.capacity() >= acc.bits());
+}
+
+BOOST_AUTO_TEST_CASE(move_assignment_keeps_buffers) {
+    N current("123456789012345678901234567890");
+    N next;
+    current.reserve(2048U);
+    next.reserve(2048U);
+
+    for (int i = 0; i < 10; ++i) {
+        next = current;
+        next.mul_limb(3U);
+        current = std::move(next);
+    }
+
+    BOOST_TEST(current == N("123456789012345678901234567890") * N(59049));
+    BOOST_TEST(current.capacity() >= 2048U);
+    BOOST_TEST(next.capacity() >= 2048U);
+    BOOST_TEST(next.is_zero());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -200,4 +200,27 @@ BOOST_AUTO_TEST_CASE(stream_operations) {
     BOOST_TEST(input == -123);
 }
 
+BOOST_AUTO_TEST_CASE(fused_kernels) {
+    const Z a("-123456789012345678901234567890");
+    const Z b("98765432109876543210");
+    const Z c(42);
+
+    Z x = c;
+    x.addmul(a, b);
+    BOOST_TEST(x == c + a * b);
+    BOOST_TEST(x.is_negative());
+
+    x.submul(a, b);
+    BOOST_TEST(x == c);
+
+    x = c;
+    x.fma_2exp(a, b, 70U);
+    BOOST_TEST(x == c + ((a * b) << 70U));
+
+    x = a;
+    x.submul(a, Z(1));
+    BOOST_TEST(x.is_zero());
+    BOOST_TEST(x.is_positive());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -14,7 +14,17 @@
 // You should have received a copy of the GNU General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+#include <algorithm>
+#include <array>
 #include <boost/test/unit_test.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #include "all.hpp"
 
@@ -110,6 +120,153 @@ BOOST_AUTO_TEST_CASE(gcd_multiple_of_small_primes) {
     BOOST_TEST(result == N(30));
 }
 
+BOOST_AUTO_TEST_CASE(gcd_multi_digit_common_factor) {
+    // operands of several digits take the Lehmer path
+    const N g("340282366920938463463374607431768211507");
+    const N cofactor("98765432109876543210987654321098765432109");
+    const N a = cofactor * g;
+    const N b = (cofactor + N(1)) * g;  // consecutive cofactors are coprime
+    BOOST_TEST(calc::gcd(a, b) == g);
+    BOOST_TEST(calc::gcd(b, a) == g);
+}
+
+BOOST_AUTO_TEST_CASE(gcd_large_consecutive_fibonacci) {
+    // consecutive Fibonacci numbers are the worst case for Euclid: all quotients are 1
+    N f0(0);
+    N f1(1);
+    for (int i = 0; i < 1000; ++i) {
+        N next = f0 + f1;
+        f0 = std::move(f1);
+        f1 = std::move(next);
+    }
+    BOOST_TEST(calc::gcd(f0, f1) == 1);
+    BOOST_TEST(calc::gcd(f0 * N(12), f1 * N(12)) == 12);
+}
+
+BOOST_AUTO_TEST_CASE(gcd_very_different_sizes) {
+    // the quotient is far too large for the leading digits, forcing a division step
+    const N small("18446744073709551629");
+    const N large = (N(1) << 2000U) * small + small * N(3);
+    BOOST_TEST(calc::gcd(large, small) == small);
+    BOOST_TEST(calc::gcd(large + N(1), small) == calc::gcd(N(1), small));
+}
+
+BOOST_AUTO_TEST_CASE(gcd_of_range) {
+    const N g = calc::pow(N(6), N(100));
+    const std::vector<N> values{N(0), N(12) * g, N(18) * g, N(30) * g, N(0)};
+    BOOST_TEST(calc::gcd(values) == N(6) * g);
+
+    // the running GCD reaches 1 after two values
+    const std::list<N> coprime{N(35), N(49), N(10), g};
+    BOOST_TEST(calc::gcd(coprime) == 1);
+    BOOST_TEST(calc::gcd(std::list<N>{N(35), N(49), N(7)}) == 7);
+
+    BOOST_TEST(calc::gcd(std::vector<N>{}).is_zero());
+    BOOST_TEST(calc::gcd(std::vector<N>{N(0), N(0)}).is_zero());
+    BOOST_TEST(calc::gcd(std::vector<N>{g}) == g);
+}
+
+BOOST_AUTO_TEST_CASE(lcm_values) {
+    for (unsigned a = 0U; a < 40U; ++a) {
+        for (unsigned b = 0U; b < 40U; ++b) {
+            BOOST_TEST(calc::lcm(N(a), N(b)) == N(std::lcm(a, b)));
+        }
+    }
+
+    const N a = calc::pow(N(6), N(100));
+    const N b = calc::pow(N(10), N(80));
+    const N expected = calc::pow(N(2), N(100)) * calc::pow(N(3), N(100)) * calc::pow(N(5), N(80));
+    BOOST_TEST(calc::lcm(a, b) == expected);
+    BOOST_TEST(calc::lcm(b, a) == expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// ============================================================================
+// Extended GCD and Modular Inverse Tests
+// ============================================================================
+
+BOOST_AUTO_TEST_SUITE(gcdext_tests)
+
+BOOST_AUTO_TEST_CASE(gcdext_basic) {
+    const auto [g, s, t] = calc::gcdext(N(240), N(46));
+    BOOST_TEST(g == 2);
+    BOOST_TEST(s == -9);
+    BOOST_TEST(t == 47);
+}
+
+BOOST_AUTO_TEST_CASE(gcdext_zero_operands) {
+    const auto [g1, s1, t1] = calc::gcdext(N(0), N(0));
+    BOOST_TEST(g1 == 0);
+    BOOST_TEST(s1 == 0);
+    BOOST_TEST(t1 == 0);
+
+    const auto [g2, s2, t2] = calc::gcdext(N(12), N(0));
+    BOOST_TEST(g2 == 12);
+    BOOST_TEST(s2 == 1);
+    BOOST_TEST(t2 == 0);
+
+    const auto [g3, s3, t3] = calc::gcdext(N(0), N(12));
+    BOOST_TEST(g3 == 12);
+    BOOST_TEST(s3 == 0);
+    BOOST_TEST(t3 == 1);
+}
+
+BOOST_AUTO_TEST_CASE(gcdext_large_bezout_identity) {
+    const N factor("340282366920938463463374607431768211507");
+    const N a = (N(1) << 1500U) * factor + N(12345) * factor;
+    const N b = (N(1) << 1100U) * factor + N(777) * factor;
+
+    const auto [g, s, t] = calc::gcdext(a, b);
+    BOOST_TEST(g == Z(calc::gcd(a, b)));
+    BOOST_TEST(s * Z(a) + t * Z(b) == g);
+
+    // minimal cofactors: |s| <= b / (2g), |t| <= a / (2g)
+    BOOST_TEST(s.abs() * N(2) * g.abs() <= b);
+    BOOST_TEST(t.abs() * N(2) * g.abs() <= a);
+}
+
+BOOST_AUTO_TEST_CASE(mod_inverse_basic) {
+    BOOST_TEST(calc::mod_inverse(N(3), N(7)).value() == 5);
+    BOOST_TEST(calc::mod_inverse(N(10), N(7)).value() == 5);  // reduced first
+    BOOST_TEST(calc::mod_inverse(N(3), N(1)).value() == 0);
+    BOOST_TEST(!calc::mod_inverse(N(6), N(9)).has_value());
+    BOOST_TEST(!calc::mod_inverse(N(0), N(9)).has_value());
+    BOOST_CHECK_THROW((void)calc::mod_inverse(N(3), N(0)), error::division_by_zero);
+}
+
+BOOST_AUTO_TEST_CASE(mod_inverse_large_prime) {
+    const N p = (N(1) << 521U) - N(1);  // Mersenne prime
+    const N a("123456789012345678901234567890123456789012345678901234567890");
+
+    const N inv = calc::mod_inverse(a, p).value();
+    BOOST_TEST(inv < p);
+    BOOST_TEST((a * inv / p).second == 1);
+}
+
+BOOST_AUTO_TEST_CASE(batch_mod_inverse_matches_single) {
+    const N p = (N(1) << 127U) - N(1);  // Mersenne prime
+
+    std::vector<N> values;
+    for (unsigned i = 1U; i <= 20U; ++i) {
+        values.push_back(calc::pow(N(i + 2U), N(i * 7U)));
+    }
+
+    const auto inverses = calc::batch_mod_inverse(values, p);
+    BOOST_REQUIRE(inverses.has_value());
+    BOOST_REQUIRE(inverses->size() == values.size());
+
+    for (std::size_t i = 0U; i < values.size(); ++i) {
+        BOOST_TEST((*inverses)[i] == calc::mod_inverse(values[i], p).value());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(batch_mod_inverse_non_invertible) {
+    const std::vector<N> values{N(2), N(4), N(9), N(5)};
+    BOOST_TEST(!calc::batch_mod_inverse(values, N(15)).has_value());
+    BOOST_TEST(calc::batch_mod_inverse(std::vector<N>{}, N(15)).value().empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 // ============================================================================
@@ -231,6 +388,28 @@ BOOST_AUTO_TEST_CASE(sqrt_very_large_number) {
     BOOST_TEST(num < root_plus_one_squared);
 }
 
+BOOST_AUTO_TEST_CASE(sqrt_newton_all_lengths) {
+    // every bit length up to 3000 bits around the floating-point start (54 bits) and the
+    // precision doublings, for squares, their neighbours and 2^k - 1
+    N x("3141592653589793238462643383279502884197169399375105820974944592307816406286");
+    for (unsigned bits = 1U; bits <= 3000U; bits += bits < 130U ? 1U : 37U) {
+        const N root = (x >> (x.bits() > bits ? x.bits() - bits : 0U)) | N(1);
+        const N square = root * root;
+
+        BOOST_TEST((calc::sqrt(square) == std::pair(root, N(0))));
+        BOOST_TEST((calc::sqrt(square - N(1)) == std::pair(root - N(1), root + root - N(2))));
+        BOOST_TEST((calc::sqrt(square + root + root) == std::pair(root, root + root)));
+        BOOST_TEST(calc::sqrt_whole(square + root + root + N(1)) == root + N(1));
+
+        const N all_ones = (N(1) << bits) - N(1);
+        const auto [r, rem] = calc::sqrt(all_ones);
+        BOOST_TEST(r * r + rem == all_ones);
+        BOOST_TEST(rem <= r + r);
+
+        if (x.bits() <= bits) { x = x * x + N(17); }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 // ============================================================================
@@ -282,6 +461,688 @@ BOOST_AUTO_TEST_CASE(sqrt_whole_powers_of_ten) {
 
 BOOST_AUTO_TEST_SUITE_END()
 
+// ============================================================================
+// Root and Perfect Power Tests
+// ============================================================================
+
+BOOST_AUTO_TEST_SUITE(root_tests)
+
+BOOST_AUTO_TEST_CASE(root_small_values) {
+    BOOST_TEST((calc::root(N(27), 3U) == std::pair(N(3), N(0))));
+    BOOST_TEST((calc::root(N(26), 3U) == std::pair(N(2), N(18))));
+    BOOST_TEST((calc::root(N(1024), 10U) == std::pair(N(2), N(0))));
+    BOOST_TEST((calc::root(N(1023), 10U) == std::pair(N(1), N(1022))));
+    BOOST_TEST((calc::root(N(12345), 1U) == std::pair(N(12345), N(0))));
+    BOOST_TEST((calc::root(N(150), 2U) == std::pair(N(12), N(6))));
+    BOOST_TEST((calc::root(N(0), 5U) == std::pair(N(0), N(0))));
+    BOOST_TEST((calc::root(N(1), 5U) == std::pair(N(1), N(0))));
+    BOOST_TEST((calc::root(N(5), 100U) == std::pair(N(1), N(4))));
+
+    BOOST_CHECK_THROW((void)calc::root(N(8), 0U), error::division_by_zero);
+}
+
+BOOST_AUTO_TEST_CASE(root_large_values) {
+    const N base("31415926535897932384626433832795028841971693993751058209749445923");
+
+    for (const bitcount_t k : {3U, 4U, 5U, 7U, 16U, 31U, 64U, 200U}) {
+        const N power = calc::pow(base, N(k));
+
+        BOOST_TEST((calc::root(power, k) == std::pair(base, N(0))));
+        BOOST_TEST(calc::root(power - N(1), k).first == base - N(1));
+        BOOST_TEST(calc::root(power + N(1), k).second == 1);
+
+        const N next = calc::pow(base + N(1), N(k));
+        const auto [r, rem] = calc::root(next - N(1), k);
+        BOOST_TEST(r == base);
+        BOOST_TEST(rem == next - N(1) - power);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(is_square_values) {
+    unsigned squares = 0U;
+    for (unsigned i = 0U; i <= 10000U; ++i) {
+        if (calc::is_square(N(i))) { ++squares; }
+    }
+    BOOST_TEST(squares == 101U);  // 0², 1², ..., 100²
+
+    const N big("170141183460469231731687303715884105727");
+    BOOST_TEST(calc::is_square(big * big));
+    BOOST_TEST(!calc::is_square(big * big + N(1)));
+    BOOST_TEST(!calc::is_square(big * big - N(1)));
+    BOOST_TEST(!calc::is_square(big * (big + N(2))));
+}
+
+BOOST_AUTO_TEST_CASE(is_perfect_power_values) {
+    unsigned powers = 0U;
+    for (unsigned i = 0U; i <= 1000U; ++i) {
+        if (calc::is_perfect_power(N(i))) { ++powers; }
+    }
+    // 0, 1 and the 40 perfect powers 4, 8, 9, ..., 1000 (OEIS A001597)
+    BOOST_TEST(powers == 42U);
+
+    const N p("170141183460469231731687303715884105727");
+    BOOST_TEST(calc::is_perfect_power(calc::pow(p, N(3))));
+    BOOST_TEST(calc::is_perfect_power(calc::pow(p, N(35))));
+    BOOST_TEST(calc::is_perfect_power(N(1) << 97U));
+    BOOST_TEST(calc::is_perfect_power(calc::pow(N(3), N(101))));
+    BOOST_TEST(!calc::is_perfect_power(calc::pow(p, N(3)) + N(1)));
+    BOOST_TEST(!calc::is_perfect_power(calc::pow(p, N(2)) * N(2)));
+    BOOST_TEST(!calc::is_perfect_power(p));
+
+    // exponents above 2^15 still get residue filters before any root is taken
+    BOOST_TEST(!calc::is_perfect_power((N(1) << 40000U) + N(1)));
+    BOOST_TEST(calc::is_perfect_power(calc::pow(N(3), N(32771))));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// ============================================================================
+// Integer Logarithm Tests
+// ============================================================================
+
+BOOST_AUTO_TEST_SUITE(ilog_tests)
+
+BOOST_AUTO_TEST_CASE(ilog_at_powers) {
+    for (const unsigned base : {2U, 3U, 10U, 255U, 1000003U}) {
+        for (unsigned k = 1U; k < 200U; k += 13U) {
+            const N power = calc::pow(N(base), N(k));
+            BOOST_TEST(calc::ilog(power, N(base)) == k);
+            BOOST_TEST(calc::ilog(power - N(1), N(base)) == k - 1U);
+            BOOST_TEST(calc::ilog(power + N(1), N(base)) == k);
+        }
+    }
+
+    const N big = calc::pow(N(7), N(1000));
+    BOOST_TEST(calc::ilog(big, N(49)) == 500U);
+    BOOST_TEST(calc::ilog(big, big) == 1U);
+    BOOST_TEST(calc::ilog(big - N(1), big) == 0U);
+    BOOST_TEST(calc::ilog(N(1), N(10)) == 0U);
+}
+
+BOOST_AUTO_TEST_CASE(ilog2_ilog10_values) {
+    BOOST_TEST(calc::ilog2(N(1)) == 0U);
+    BOOST_TEST(calc::ilog2(N(1) << 100U) == 100U);
+    BOOST_TEST(calc::ilog2((N(1) << 100U) - N(1)) == 99U);
+
+    BOOST_TEST(calc::ilog10(N(9)) == 0U);
+    BOOST_TEST(calc::ilog10(N(10)) == 1U);
+    for (unsigned i = 0U; i < 200U; ++i) {
+        const N num = calc::pow(N(i + 2U), N(i + 1U)) + N(i);
+        BOOST_TEST(calc::ilog10(num) + 1U == num.to_str().size());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ilog_small_limbs) {
+    using N8 = basic_N<std::uint8_t, std::uint16_t>;
+
+    const N8 power = calc::pow(N8(10), N8(77));
+    BOOST_TEST(calc::ilog10(power) == 77U);
+    BOOST_TEST(calc::ilog10(power - N8(1)) == 76U);
+    BOOST_TEST(calc::ilog(power, N8(1000)) == 25U);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// ============================================================================
+// Primality Tests
+// ============================================================================
+
+BOOST_AUTO_TEST_SUITE(primality_tests)
+
+BOOST_AUTO_TEST_CASE(is_probable_prime_small_numbers) {
+    unsigned primes = 0U;
+    for (unsigned i = 0U; i < 10000U; ++i) {
+        if (calc::is_probable_prime(N(i))) { ++primes; }
+    }
+    BOOST_TEST(primes == 1229U);
+
+    // above the trial division bound of 1024²
+    primes = 0U;
+    for (unsigned i = 1U << 20U; i < (1U << 20U) + 20000U; ++i) {
+        if (calc::is_probable_prime(N(i))) { ++primes; }
+    }
+    BOOST_TEST(primes == 1416U);
+}
+
+BOOST_AUTO_TEST_CASE(is_probable_prime_large_numbers) {
+    const N m127 = (N(1) << 127U) - N(1);
+    const N m521 = (N(1) << 521U) - N(1);
+    const N m607 = (N(1) << 607U) - N(1);
+
+    BOOST_TEST(calc::is_probable_prime(m127));
+    BOOST_TEST(calc::is_probable_prime(m521, 8U));
+    BOOST_TEST(calc::is_probable_prime(m607));
+
+    BOOST_TEST(!calc::is_probable_prime((N(1) << 523U) - N(1)));  // 2^523 - 1 is composite
+    BOOST_TEST(!calc::is_probable_prime(m127 * m521));
+    BOOST_TEST(!calc::is_probable_prime(m127 * m127));
+    BOOST_TEST(!calc::is_probable_prime(m521 + N(2), 4U));
+}
+
+BOOST_AUTO_TEST_CASE(is_probable_prime_pseudoprimes) {
+    // strong pseudoprime to the prime bases 2, 3, ..., 31, caught by the Lucas test
+    BOOST_TEST(!calc::is_probable_prime(N("3825123056546413051")));
+    // smallest strong pseudoprime to the prime bases 2, 3, ..., 37, caught by the Lucas test
+    BOOST_TEST(!calc::is_probable_prime(N("318665857834031151167461")));
+
+    // Carmichael numbers
+    BOOST_TEST(!calc::is_probable_prime(N(561)));
+    BOOST_TEST(!calc::is_probable_prime(N("3215031751")));
+    BOOST_TEST(!calc::is_probable_prime(N("2199733160881")));
+}
+
+BOOST_AUTO_TEST_CASE(is_probable_prime_small_limbs) {
+    using N8 = basic_N<std::uint8_t, std::uint16_t>;
+
+    BOOST_TEST(calc::is_probable_prime(N8(1000000007)));
+    BOOST_TEST(!calc::is_probable_prime(N8(1000000007) * N8(998244353)));
+    BOOST_TEST(calc::is_probable_prime((N8(1) << 127U) - N8(1), 2U));
+}
+
+BOOST_AUTO_TEST_CASE(next_prime_values) {
+    BOOST_TEST(calc::next_prime(N(0)) == N(2));
+    BOOST_TEST(calc::next_prime(N(2)) == N(3));
+    BOOST_TEST(calc::next_prime(N(1000000000000ULL)) == N(1000000000039ULL));
+
+    // through the sieve
+    const N two_64 = N(1) << 64U;
+    BOOST_TEST(calc::next_prime(N(1) << 20U) == (N(1) << 20U) + N(7));
+    BOOST_TEST(calc::next_prime(two_64) == two_64 + N(13));
+    BOOST_TEST(calc::next_prime(N(1) << 128U) == (N(1) << 128U) + N(51));
+
+    unsigned count = 0U;
+    for (N p(1U << 20U); p < N((1U << 20U) + 20000U); p = calc::next_prime(p)) { ++count; }
+    BOOST_TEST(count == 1417U);  // 1416 primes and the start
+}
+
+BOOST_AUTO_TEST_CASE(next_prime_safe) {
+    const std::vector<unsigned> starts{0U, 5U, 7U, 11U, 23U, 100U};
+    const std::vector<unsigned> expected{5U, 7U, 11U, 23U, 47U, 107U};
+    for (std::size_t i = 0U; i < starts.size(); ++i) {
+        BOOST_TEST(calc::next_prime(N(starts[i]), true) == N(expected[i]));
+    }
+
+    BOOST_TEST(calc::next_prime(N(1) << 20U, true) == (N(1) << 20U) + N(127));
+    BOOST_TEST(calc::next_prime(N(1) << 64U, true) == (N(1) << 64U) + N(3103));
+
+    using N8 = basic_N<std::uint8_t, std::uint16_t>;
+    BOOST_TEST(calc::next_prime(N8(1) << 128U, true) == (N8(1) << 128U) + N8(12451));
+}
+
+BOOST_AUTO_TEST_CASE(random_prime_lengths) {
+    for (const bitcount_t bits : {2U, 3U, 10U, 20U, 21U, 64U, 256U}) {
+        const N p = calc::random_prime<N>(bits);
+        BOOST_TEST(p.bits() == bits);
+        BOOST_TEST(calc::is_probable_prime(p));
+    }
+
+    for (const bitcount_t bits : {3U, 10U, 21U, 128U}) {
+        const N p = calc::random_prime<N>(bits, true);
+        BOOST_TEST(p.bits() == bits);
+        BOOST_TEST(calc::is_probable_prime(p));
+        BOOST_TEST(calc::is_probable_prime(p >> 1U));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// ============================================================================
+// Jacobi Symbol and Modular Square Root Tests
+// ============================================================================
+
+BOOST_AUTO_TEST_SUITE(jacobi_tests)
+
+BOOST_AUTO_TEST_CASE(jacobi_matches_euler_criterion) {
+    const std::vector<N> primes{N(3),
+                                N(13),
+                                N(65537),
+                                N(1000000007),
+                                (N(1) << 127U) - N(1),
+                                (N(1) << 521U) - N(1)};
+
+    for (const N & p : primes) {
+        for (unsigned i = 0U; i < 60U; ++i) {
+            const N a = (calc::pow(N(i + 2U), N(i + 40U)) / p).second;
+            const N euler = calc::pow_mod(a, (p - N(1)) >> 1U, p);
+            const int expected = euler.is_zero() ? 0 : (euler.is_one() ? 1 : -1);
+            BOOST_TEST(calc::jacobi(a, p) == expected);
+            BOOST_TEST(calc::jacobi(a + p * N(i), p) == expected);  // a larger than p
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(jacobi_composite_moduli) {
+    // (a / mn) = (a / m)(a / n)
+    const N m = (N(1) << 89U) - N(1);
+    const N n = (N(1) << 107U) - N(1);
+    for (unsigned a = 0U; a < 50U; ++a) {
+        BOOST_TEST(calc::jacobi(N(a), m * n) == calc::jacobi(N(a), m) * calc::jacobi(N(a), n));
+    }
+
+    BOOST_TEST(calc::jacobi(N(1001), N(9907)) == -1);
+    BOOST_TEST(calc::jacobi(N(2), N(15)) == 1);  // 2 is no square modulo 15
+    BOOST_TEST(calc::jacobi(N(8), N(21)) == -1);
+    BOOST_TEST(calc::jacobi(N(5), N(21)) == 1);
+    BOOST_TEST(calc::jacobi(N(21), N(21)) == 0);
+    BOOST_TEST(calc::jacobi(m * N(3), m * n) == 0);
+    BOOST_TEST(calc::jacobi(N(0), N(1)) == 1);
+
+    BOOST_CHECK_THROW((void)calc::jacobi(N(3), N(10)), error::invalid_modulus);
+    BOOST_CHECK_THROW((void)calc::jacobi(N(3), N(0)), error::invalid_modulus);
+}
+
+BOOST_AUTO_TEST_CASE(kronecker_values) {
+    BOOST_TEST(calc::kronecker(N(1), N(0)) == 1);
+    BOOST_TEST(calc::kronecker(N(2), N(0)) == 0);
+    BOOST_TEST(calc::kronecker(N(3), N(8)) == -1);
+    BOOST_TEST(calc::kronecker(N(7), N(2)) == 1);
+    BOOST_TEST(calc::kronecker(N(5), N(12)) == -1);
+    BOOST_TEST(calc::kronecker(N(4), N(6)) == 0);
+    BOOST_TEST(calc::kronecker(N(11), N(15)) == calc::jacobi(N(11), N(15)));
+}
+
+BOOST_AUTO_TEST_CASE(sqrt_mod_roots) {
+    // one prime per branch: 3 mod 4, 5 mod 8, 1 mod 8 with small and large powers of 2
+    const std::vector<N> primes{N(2),
+                                N(7),
+                                N(13),
+                                N(41),
+                                N(65537),
+                                N(998244353),  // 119 × 2^23 + 1
+                                (N(1) << 127U) - N(1),
+                                N(15) * (N(1) << 27U) + N(1),
+                                N(27) * (N(1) << 59U) + N(1)};
+
+    for (const N & p : primes) {
+        BOOST_REQUIRE(calc::is_probable_prime(p));
+        unsigned roots = 0U;
+        for (unsigned i = 0U; i < 40U; ++i) {
+            const N a = (calc::pow(N(i + 3U), N(i + 20U)) / p).second;
+            const auto root = calc::sqrt_mod(a, p);
+            if (p.is_odd() && calc::jacobi(a, p) == -1) {
+                BOOST_TEST(!root.has_value());
+                continue;
+            }
+            BOOST_REQUIRE(root.has_value());
+            BOOST_TEST(((*root * *root) / p).second == a);
+            BOOST_TEST(*root <= (p >> 1U));
+            ++roots;
+        }
+        BOOST_TEST(roots > 0U);
+    }
+
+    BOOST_TEST(*calc::sqrt_mod(N(2), N(7)) == N(3));
+    BOOST_TEST(*calc::sqrt_mod(N(0), N(13)) == N(0));
+    BOOST_TEST(*calc::sqrt_mod(N(13 * 5 + 4), N(13)) == N(2));  // a larger than p
+    BOOST_TEST(!calc::sqrt_mod(N(3), N(7)).has_value());
+
+    BOOST_CHECK_THROW((void)calc::sqrt_mod(N(4), N(0)), error::division_by_zero);
+    BOOST_CHECK_THROW((void)calc::sqrt_mod(N(4), N(8)), error::invalid_modulus);
+}
+
+BOOST_AUTO_TEST_CASE(sqrt_mod_cipolla) {
+    // p - 1 divisible by 2^120 and p of 123 bits, so s² > 16 × bits(p) picks Cipolla
+    N p = (N(1) << 120U) * N(3) + N(1);
+    while (!calc::is_probable_prime(p)) { p += N(1) << 121U; }
+
+    for (unsigned i = 2U; i < 30U; ++i) {
+        const N root = (calc::pow(N(i), N(30)) / p).second;
+        const N a = (root * root / p).second;
+        const auto found = calc::sqrt_mod(a, p);
+        BOOST_REQUIRE(found.has_value());
+        BOOST_TEST((*found == root || *found == p - root));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sqrt_mod_square_moduli) {
+    // modulo a square the Jacobi symbol is never -1, so Tonelli-Shanks (p ≡ 1 mod 8) and
+    // Cipolla ((2^31 + 1)², s = 32) find no non-residue; the result is a root or nothing
+    const N big = (N(1) << 31U) + N(1);
+    for (const N & p : {N(9), N(25), N(49), N(289), N(3 * 3 * 7 * 7), big * big}) {
+        for (unsigned i = 1U; i < 60U; ++i) {
+            const N a(i);
+            if (calc::jacobi(a, p) != 1) { continue; }
+            const auto root = calc::sqrt_mod(a, p);
+            if (root.has_value()) { BOOST_TEST((*root * *root / p).second == (a / p).second); }
+        }
+    }
+
+    // squares of large primes, where (z / p) = 0 only for z ≥ the prime
+    const N m127 = (N(1) << 127U) - N(1);
+    const N m1279 = (N(1) << 1279U) - N(1);
+    for (const N & p : {m127 * m127, m1279 * m1279}) {
+        BOOST_TEST(!calc::sqrt_mod(N(4), p).has_value());
+        BOOST_TEST(!calc::sqrt_mod(N(12345) * N(12345), p).has_value());
+        BOOST_TEST(calc::sqrt_mod(p, p) == N(0));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(jacobi_small_limbs) {
+    using N8 = basic_N<std::uint8_t, std::uint16_t>;
+
+    const N8 p8 = (N8(1) << 127U) - N8(1);
+    const N p = (N(1) << 127U) - N(1);
+    for (unsigned a = 1U; a < 40U; ++a) {
+        BOOST_TEST(calc::jacobi(N8(a) << 100U, p8) == calc::jacobi(N(a) << 100U, p));
+    }
+
+    const auto root8 = calc::sqrt_mod(N8(12345), N8(1000000009));
+    const auto root = calc::sqrt_mod(N(12345), N(1000000009));
+    BOOST_REQUIRE(root8.has_value() == root.has_value());
+    if (root) { BOOST_TEST(root8->to_str() == root->to_str()); }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// ============================================================================
+// Factorial and Binomial Tests
+// ============================================================================
+
+BOOST_AUTO_TEST_SUITE(factorial_tests)
+
+BOOST_AUTO_TEST_CASE(factorial_matches_product) {
+    N expected(1);
+    for (unsigned n = 0U; n <= 1500U; ++n) {
+        if (n > 0U) { expected *= N(n); }
+        BOOST_TEST(calc::factorial<N>(n) == expected);
+    }
+
+    BOOST_TEST(calc::factorial<N>(20U) == N(2432902008176640000ULL));
+}
+
+BOOST_AUTO_TEST_CASE(multifactorial_matches_product) {
+    for (unsigned m = 1U; m <= 4U; ++m) {
+        for (unsigned n = 0U; n <= 300U; ++n) {
+            N expected(1);
+            for (unsigned factor = n; factor > 0U; factor -= std::min(factor, m)) {
+                expected *= N(factor);
+            }
+            BOOST_TEST(calc::multifactorial<N>(n, m) == expected);
+        }
+    }
+
+    BOOST_TEST(calc::double_factorial<N>(9U) == N(945));
+    BOOST_TEST(calc::double_factorial<N>(10U) == N(3840));
+}
+
+BOOST_AUTO_TEST_CASE(binomial_matches_pascal_triangle) {
+    std::vector<N> row{N(1)};
+    for (unsigned n = 1U; n <= 120U; ++n) {
+        std::vector<N> next(n + 1U, N(1));
+        for (unsigned k = 1U; k < n; ++k) { next[k] = row[k - 1U] + row[k]; }
+        row = std::move(next);
+
+        for (unsigned k = 0U; k <= n; ++k) { BOOST_TEST(calc::binomial<N>(n, k) == row[k]); }
+        BOOST_TEST(calc::binomial<N>(n, n + 1U).is_zero());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(binomial_large_n) {
+    // above the sieve bound
+    BOOST_TEST(calc::binomial<N>(100000000000ULL, 3U) == N("166666666661666666666700000000000"));
+    BOOST_TEST(calc::binomial<N>((1ULL << 26U) + 5U, 4U) ==
+               N("845100576453848284613885034501"));
+    BOOST_TEST(calc::binomial<N>(1ULL << 30U, 2U) == N(576460751766552576ULL));
+
+    using N8 = basic_N<std::uint8_t, std::uint16_t>;
+    BOOST_TEST(calc::binomial<N8>(1000U, 500U).to_str() == calc::binomial<N>(1000U, 500U).to_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// ============================================================================
+// Product and Remainder Tree Tests
+// ============================================================================
+
+BOOST_AUTO_TEST_SUITE(product_tree_tests)
+
+BOOST_AUTO_TEST_CASE(product_matches_loop) {
+    for (const unsigned count : {0U, 1U, 2U, 3U, 7U, 100U}) {
+        std::vector<N> values;
+        N expected(1);
+        for (unsigned i = 0U; i < count; ++i) {
+            values.push_back(calc::pow(N(i + 3U), N(i % 40U + 1U)));
+            expected *= values.back();
+        }
+
+        BOOST_TEST(calc::product(values) == expected);
+    }
+
+    const std::array<N, 4U> factors{N(2), N(3), N(0), N(5)};
+    BOOST_TEST(calc::product(factors).is_zero());
+}
+
+BOOST_AUTO_TEST_CASE(remainder_tree_matches_division) {
+    const N num = calc::pow(N(3), N(2000)) + N(12345);
+
+    std::vector<N> moduli;
+    for (unsigned i = 1U; i <= 50U; ++i) {
+        moduli.push_back(calc::pow(N(i + 1U), N(i % 9U + 1U)) + N(i));
+    }
+    moduli.push_back(num + N(1));  // larger than num
+    moduli.push_back(N(1));
+
+    const std::vector<N> remainders = calc::remainder_tree(num, moduli);
+    BOOST_REQUIRE(remainders.size() == moduli.size());
+    for (std::size_t i = 0U; i < moduli.size(); ++i) {
+        BOOST_TEST(remainders[i] == (num / moduli[i]).second);
+    }
+
+    BOOST_TEST(calc::remainder_tree(num, std::vector<N>{}).empty());
+    BOOST_CHECK_THROW((void)calc::remainder_tree(num, std::vector<N>{N(3), N(0)}),
+                      error::division_by_zero);
+}
+
+BOOST_AUTO_TEST_CASE(batch_gcd_matches_pairwise) {
+    std::vector<N> primes;
+    for (unsigned i = 0U; i < 41U; ++i) {
+        primes.push_back(calc::next_prime(N(1000003) * N(i + 1U) << 40U));
+    }
+
+    // products of two primes, a few of them sharing a prime with another value
+    std::vector<N> values;
+    for (unsigned i = 0U; i + 1U < primes.size(); i += 2U) {
+        values.push_back(primes[i] * primes[i + 1U]);
+    }
+    values.push_back(primes[0] * primes[40]);
+    values.push_back(primes[7] * primes[40]);
+    values.push_back(primes[12] * primes[13]);  // equal to another value
+
+    const std::vector<N> gcds = calc::batch_gcd(values);
+    BOOST_REQUIRE(gcds.size() == values.size());
+    for (std::size_t i = 0U; i < values.size(); ++i) {
+        N others(1);
+        for (std::size_t j = 0U; j < values.size(); ++j) {
+            if (j != i) { others *= values[j]; }
+        }
+        BOOST_TEST(gcds[i] == calc::gcd(values[i], others));
+    }
+    BOOST_TEST(gcds[0] == primes[0]);
+    BOOST_TEST(gcds[3] == primes[7]);
+    BOOST_TEST(gcds[6] == values[6]);
+    BOOST_TEST(gcds[1] == 1);
+
+    BOOST_TEST(calc::batch_gcd(std::vector<N>{N(77)}) == std::vector<N>{N(1)});
+    BOOST_TEST(calc::batch_gcd(std::vector<N>{}).empty());
+    BOOST_CHECK_THROW((void)calc::batch_gcd(std::vector<N>{N(3), N(0)}), error::division_by_zero);
+}
+
+BOOST_AUTO_TEST_CASE(remainder_tree_small_limbs) {
+    using N8 = basic_N<std::uint8_t, std::uint16_t>;
+
+    const N8 num = (N8(1) << 300U) + N8(977);
+    const std::vector<N8> moduli{N8(251), N8(65521), N8(1000000007), (N8(1) << 100U) - N8(1)};
+
+    const std::vector<N8> remainders = calc::remainder_tree(num, moduli);
+    for (std::size_t i = 0U; i < moduli.size(); ++i) {
+        BOOST_TEST(remainders[i] == (num / moduli[i]).second);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// ============================================================================
+// Fibonacci and Lucas Tests
+// ============================================================================
+
+BOOST_AUTO_TEST_SUITE(fibonacci_tests)
+
+BOOST_AUTO_TEST_CASE(fibonacci_lucas_match_recurrence) {
+    N f0(0), f1(1), l0(2), l1(1);
+    for (std::uint64_t n = 0U; n < 300U; ++n) {
+        BOOST_TEST(calc::fibonacci<N>(n) == f0);
+        BOOST_TEST(calc::lucas<N>(n) == l0);
+
+        const auto [f, f_next] = calc::fibonacci_pair<N>(n);
+        BOOST_TEST(f == f0);
+        BOOST_TEST(f_next == f1);
+
+        const auto [l, l_next] = calc::lucas_pair<N>(n);
+        BOOST_TEST(l == l0);
+        BOOST_TEST(l_next == l1);
+
+        f0 += f1;
+        std::swap(f0, f1);
+        l0 += l1;
+        std::swap(l0, l1);
+    }
+
+    BOOST_TEST(calc::fibonacci<N>(100U) == N("354224848179261915075"));
+    BOOST_TEST(calc::lucas<N>(100U) == N("792070839848372253127"));
+}
+
+BOOST_AUTO_TEST_CASE(fibonacci_identities) {
+    // F(2n) = F(n) × L(n) and L(n)² - 5F(n)² = 4(-1)^n
+    for (const std::uint64_t n : {1000U, 4097U, 20000U}) {
+        const N f = calc::fibonacci<N>(n);
+        const N l = calc::lucas<N>(n);
+        BOOST_TEST(calc::fibonacci<N>(2U * n) == f * l);
+        if (n % 2U == 0U) {
+            BOOST_TEST(l * l == N(5) * f * f + N(4));
+        } else {
+            BOOST_TEST(l * l + N(4) == N(5) * f * f);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(fibonacci_mod_matches_exact) {
+    const std::vector<N> moduli{N(1),
+                                N(2),
+                                N(10),
+                                N(97),
+                                N(1000000007),
+                                (N(1) << 64U) + N(1),
+                                N(1) << 70U,
+                                (N(1) << 127U) - N(1)};
+
+    for (const std::uint64_t n : {0U, 1U, 2U, 3U, 64U, 99U, 1000U, 1001U}) {
+        const N f = calc::fibonacci<N>(n);
+        const N l = calc::lucas<N>(n);
+        for (const N & mod : moduli) {
+            BOOST_TEST(calc::fibonacci_mod(N(n), mod) == (f / mod).second);
+            BOOST_TEST(calc::lucas_mod(N(n), mod) == (l / mod).second);
+        }
+    }
+
+    // the Pisano period of 10 is 60
+    const N huge = (N(1) << 300U) * N(60) + N(7);
+    BOOST_TEST(calc::fibonacci_mod(huge, N(10)) == N(3));
+    // F(p - (5/p)) is divisible by a prime p, here p = 2^127 - 1 with (5/p) = -1
+    const N p = (N(1) << 127U) - N(1);
+    BOOST_TEST(calc::fibonacci_mod(p + N(1), p).is_zero());
+    BOOST_TEST(calc::lucas_mod(p, p) == N(1));
+
+    BOOST_CHECK_THROW((void)calc::fibonacci_mod(N(5), N(0)), error::division_by_zero);
+    BOOST_CHECK_THROW((void)calc::lucas_mod(N(5), N(0)), error::division_by_zero);
+}
+
+BOOST_AUTO_TEST_CASE(fibonacci_small_limbs) {
+    using N8 = basic_N<std::uint8_t, std::uint16_t>;
+
+    BOOST_TEST(calc::fibonacci<N8>(1000U).to_str() == calc::fibonacci<N>(1000U).to_str());
+    BOOST_TEST(calc::lucas<N8>(777U).to_str() == calc::lucas<N>(777U).to_str());
+    BOOST_TEST(calc::fibonacci_mod(N8(12345), N8(65521)).to_str() ==
+               calc::fibonacci_mod(N(12345), N(65521)).to_str());
+    BOOST_TEST(calc::lucas_mod(N8(12345), N8(65536)).to_str() ==
+               calc::lucas_mod(N(12345), N(65536)).to_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// ============================================================================
+// Binary Splitting Tests
+// ============================================================================
+
+BOOST_AUTO_TEST_SUITE(binary_splitting_tests)
+
+BOOST_AUTO_TEST_CASE(binary_splitting_matches_direct_sum) {
+    // p(k) = -(k + 2), q(k) = k + 3, a(k) = k - 5
+    const auto term = [](std::uint64_t k) -> std::tuple<Z, N, Z> {
+        return {-Z(k + 2U), N(k + 3U), Z(k) - Z(5)};
+    };
+
+    for (const auto & [first, last] : {std::pair<std::uint64_t, std::uint64_t>{0U, 1U},
+                                       {3U, 4U},
+                                       {3U, 40U},
+                                       {0U, 77U}}) {
+        const auto [p, q, t] = calc::binary_splitting<N>(first, last, term);
+
+        // T = Σ a(k) × p(first)···p(k) × q(k + 1)···q(last - 1)
+        Z p_direct(1), t_direct;
+        N q_direct(1);
+        for (std::uint64_t k = first; k < last; ++k) {
+            const auto [p_k, q_k, a_k] = term(k);
+            p_direct *= p_k;
+            q_direct *= q_k;
+
+            Z summand = a_k * p_direct;
+            for (std::uint64_t j = k + 1U; j < last; ++j) { summand *= Z(std::get<1>(term(j))); }
+            t_direct += summand;
+        }
+
+        BOOST_TEST(p == p_direct);
+        BOOST_TEST(q == q_direct);
+        BOOST_TEST(t == t_direct);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(constants_known_digits) {
+    BOOST_TEST(calc::pi_str<N>(100U) ==
+               "3.14159265358979323846264338327950288419716939937510"
+               "58209749445923078164062862089986280348253421170679");
+    BOOST_TEST(calc::e_str<N>(100U) ==
+               "2.71828182845904523536028747135266249775724709369995"
+               "95749669676277240766303535475945713821785251664274");
+    BOOST_TEST(calc::log2_str<N>(100U) ==
+               "0.69314718055994530941723212145817656807550013436025"
+               "52541206800094933936219696947156058633269964186875");
+
+    BOOST_TEST(calc::pi_str<N>(0U) == "3");
+    BOOST_TEST(calc::e_str<N>(1U) == "2.7");
+    BOOST_TEST(calc::log2_str<N>(0U) == "0");
+    BOOST_TEST(calc::log2_str<N>(1U) == "0.6");
+}
+
+BOOST_AUTO_TEST_CASE(constants_are_truncated_prefixes) {
+    using N8 = basic_N<std::uint8_t, std::uint16_t>;
+
+    const std::string pi = calc::pi_str<N>(2000U);
+    const std::string e = calc::e_str<N>(2000U);
+    const std::string log2 = calc::log2_str<N>(2000U);
+
+    for (const std::size_t digits : {5U, 13U, 14U, 15U, 28U, 333U, 1999U}) {
+        BOOST_TEST(calc::pi_str<N>(digits) == pi.substr(0U, digits + 2U));
+        BOOST_TEST(calc::e_str<N>(digits) == e.substr(0U, digits + 2U));
+        BOOST_TEST(calc::log2_str<N>(digits) == log2.substr(0U, digits + 2U));
+    }
+
+    BOOST_TEST(calc::pi_str<N8>(500U) == pi.substr(0U, 502U));
+    BOOST_TEST(calc::e_str<N8>(500U) == e.substr(0U, 502U));
+    BOOST_TEST(calc::log2_str<N8>(500U) == log2.substr(0U, 502U));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 // ============================================================================
 // Power (N) Tests
 // ============================================================================
@@ -351,6 +1212,15 @@ BOOST_AUTO_TEST_CASE(pow_base_ten) {
     BOOST_TEST(result == N("100000000000000000000"));
 }
 
+BOOST_AUTO_TEST_CASE(pow_sliding_window_exponents) {
+    // every exponent up to 300 covers windows of 1 to 4 bits with all bit patterns
+    for (unsigned e = 0U; e <= 300U; ++e) {
+        N expected(1);
+        for (unsigned i = 0U; i < e; ++i) { expected *= N(3); }
+        BOOST_TEST(calc::pow(N(3), N(e)) == expected);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(pow_large_base_small_exp) {
     N base(999999);
     N exponent(3);
@@ -442,6 +1312,59 @@ BOOST_AUTO_TEST_CASE(pow_mod_zero_exponent) {
     BOOST_TEST(result == N(1));
 }
 
+BOOST_AUTO_TEST_CASE(pow_mod_modulus_one) {
+    BOOST_TEST(calc::pow_mod(N(100), N(0), N(1)) == 0);
+    BOOST_TEST(calc::pow_mod(N(100), N(5), N(1)) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(pow_mod_window_sizes) {
+    // exponents around the window size thresholds, checked against Fermat's little
+    // theorem and against repeated squaring
+    const N p("170141183460469231731687303715884105727");  // 2^127 - 1
+    const N base("123456789123456789123456789");
+
+    for (const unsigned bits : {8U, 9U, 24U, 25U, 80U, 81U, 240U, 241U, 672U, 673U, 1793U}) {
+        const N exponent = (N(1) << bits) - N(1);
+
+        N expected = base;
+        for (unsigned i = 1U; i < bits; ++i) {
+            expected = (expected * expected * base / p).second;
+        }
+
+        BOOST_TEST(calc::pow_mod(base, exponent, p) == expected);
+        BOOST_TEST(calc::pow_mod(base, exponent * (p - N(1)), p) == 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(multi_pow_mod_matches_separate_powers) {
+    const N odd("170141183460469231731687303715884105727");  // 2^127 - 1
+    const N even = N(1) << 100U;
+
+    // a handful of terms uses Straus, 200 terms with 64-bit exponents use Pippenger
+    for (const std::size_t terms : {0U, 1U, 5U, 200U}) {
+        std::vector<N> bases;
+        std::vector<N> exponents;
+        N x("123456789123456789123456789");
+        for (std::size_t i = 0U; i < terms; ++i) {
+            x = ((x * x + N(12345)) / odd).second;
+            bases.push_back(x);
+            exponents.push_back(i % 7U == 3U ? N(0) : (x >> 20U) & ((N(1) << 64U) - N(1)));
+        }
+
+        for (const N & m : {odd, even, N(1)}) {
+            N expected = calc::pow_mod(N(1), N(0), m);
+            for (std::size_t i = 0U; i < terms; ++i) {
+                expected = (expected * calc::pow_mod(bases[i], exponents[i], m) / m).second;
+            }
+
+            BOOST_TEST(calc::multi_pow_mod(bases, exponents, m) == expected);
+        }
+    }
+
+    BOOST_CHECK_THROW((void)calc::multi_pow_mod(std::vector<N>{}, std::vector<N>{}, N(0)),
+                      error::division_by_zero);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
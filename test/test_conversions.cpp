@@ -56,6 +56,27 @@ BOOST_AUTO_TEST_CASE(n_to_string_different_bases) {
     BOOST_TEST(num.to_str(16) == "FF");       // Hexadecimal (uppercase)
 }
 
+BOOST_AUTO_TEST_CASE(n_digits_in_base_matches_to_str) {
+    BOOST_TEST(N(0).digits_in_base() == 1U);
+    BOOST_TEST(N(9).digits_in_base() == 1U);
+    BOOST_TEST(N(10).digits_in_base() == 2U);
+    BOOST_TEST(N(255).digits_in_base(16) == 2U);
+    BOOST_TEST(N(256).digits_in_base(16) == 3U);
+
+    for (unsigned base = 2U; base <= 64U; ++base) {
+        for (unsigned k = 1U; k < 120U; k += 7U) {
+            // powers of the base and their neighbours are where estimates go wrong
+            const N power = calc::pow(N(base), N(k));
+            for (const N & num : {power - N(1), power, power + N(1)}) {
+                BOOST_TEST(num.digits_in_base(base) == num.to_str(base).size());
+            }
+        }
+    }
+
+    BOOST_CHECK_THROW((void)N(5).digits_in_base(1), error::invalid_base);
+    BOOST_CHECK_THROW((void)N(5).digits_in_base(65), error::invalid_base);
+}
+
 BOOST_AUTO_TEST_CASE(n_from_string) {
     N num("67890");
     BOOST_TEST(num == 67890);
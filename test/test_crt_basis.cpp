@@ -0,0 +1,84 @@
+// The jmaths library for C++
+// Copyright (C) 2025  Jasper de Smaele
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <boost/test/unit_test.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "all.hpp"
+
+using namespace jmaths;
+
+BOOST_AUTO_TEST_SUITE(crt_basis_tests)
+
+BOOST_AUTO_TEST_CASE(reconstructs_small_moduli) {
+    const std::vector<N> moduli{N(3), N(5), N(7)};
+    const crt_basis<N> basis(moduli);
+
+    BOOST_TEST(basis.size() == 3U);
+    BOOST_TEST(basis.modulus() == N(105));
+
+    for (unsigned x = 0U; x < 105U; ++x) {
+        const std::vector<N> residues{N(x % 3U), N(x % 5U), N(x % 7U)};
+        BOOST_TEST(basis.reconstruct(residues) == N(x));
+        BOOST_TEST(basis.reconstruct_signed(residues) == (x <= 52U ? Z(x) : Z(x) - Z(105)));
+    }
+
+    // residues do not have to be reduced
+    const std::vector<N> unreduced{N(3 + 2), N(5 * 4 + 3), N(7 * 9 + 2)};
+    BOOST_TEST(basis.reconstruct(unreduced) == N(23));
+}
+
+BOOST_AUTO_TEST_CASE(reconstructs_word_primes) {
+    std::vector<N> primes;
+    N p(1ULL << 62U);
+    for (unsigned i = 0U; i < 37U; ++i) {
+        p = calc::next_prime(p);
+        primes.push_back(p);
+    }
+
+    const crt_basis<N> basis(primes);
+    BOOST_TEST(basis.modulus() == calc::product(primes));
+
+    const N x = (calc::pow(N(7), N(700)) / basis.modulus()).second;
+    BOOST_TEST(basis.reconstruct(calc::remainder_tree(x, primes)) == x);
+
+    // -x from the residues of M - x
+    const N negated = basis.modulus() - (x >> 1U);
+    BOOST_TEST(basis.reconstruct_signed(calc::remainder_tree(negated, primes)) == -Z(x >> 1U));
+}
+
+BOOST_AUTO_TEST_CASE(single_modulus_and_small_limbs) {
+    const crt_basis<N> single(std::vector<N>{N(1000000007)});
+    BOOST_TEST(single.reconstruct(std::vector<N>{N(12345)}) == N(12345));
+
+    using N8 = basic_N<std::uint8_t, std::uint16_t>;
+    const std::vector<N8> moduli{N8(251), N8(65521), (N8(1) << 61U) - N8(1), N8(1)};
+    const crt_basis<N8> basis(moduli);
+
+    const N8 x = (N8(1) << 80U) + N8(4242);
+    std::vector<N8> residues;
+    for (const N8 & m : moduli) { residues.push_back((x / m).second); }
+    BOOST_TEST(basis.reconstruct(residues) == x);
+}
+
+BOOST_AUTO_TEST_CASE(invalid_moduli_throw) {
+    BOOST_CHECK_THROW(crt_basis<N>(std::vector<N>{N(6), N(35), N(10)}), error::invalid_modulus);
+    BOOST_CHECK_THROW(crt_basis<N>(std::vector<N>{N(3), N(0)}), error::division_by_zero);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
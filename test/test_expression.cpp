@@ -0,0 +1,152 @@
+// The jmaths library for C++
+// Copyright (C) 2025  Jasper de Smaele
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <boost/test/unit_test.hpp>
+
+#include "all.hpp"
+
+using namespace jmaths;
+using jmaths::expr::lazy;
+
+BOOST_AUTO_TEST_SUITE(expression_tests)
+
+BOOST_AUTO_TEST_SUITE(n_expressions)
+
+BOOST_AUTO_TEST_CASE(sum_of_products) {
+    const N a("123456789012345678901234567890");
+    const N b("98765432109876543210");
+    const N c("5555555555555555555555");
+    const N d("77777777777777777");
+    const N e(3);
+
+    const N result = lazy(a) * b + c * d - e;
+    BOOST_TEST(result == a * b + c * d - e);
+
+    const N fused = lazy(a) * b + lazy(c) * d - e;
+    BOOST_TEST(fused == a * b + c * d - e);
+}
+
+BOOST_AUTO_TEST_CASE(accumulate_product) {
+    const N a("123456789012345678901234567890");
+    const N b("98765432109876543210");
+
+    N acc(42);
+    acc += lazy(a) * b;
+    BOOST_TEST(acc == a * b + N(42));
+
+    acc -= lazy(a) * b;
+    BOOST_TEST(acc == 42);
+}
+
+BOOST_AUTO_TEST_CASE(submul_keeps_absolute_difference) {
+    const N a("123456789012345678901234567890");
+    const N b("98765432109876543210");
+
+    N acc(42);
+    acc -= lazy(a) * b;
+    BOOST_TEST(acc == a * b - N(42));
+
+    const N nested = lazy(a) + (b - acc);
+    BOOST_TEST(nested == a + (b - acc));
+}
+
+BOOST_AUTO_TEST_CASE(shifted_product) {
+    const N a("123456789012345678901234567890");
+    const N b("98765432109876543210");
+
+    N result;
+    expr::assign(result, (lazy(a) * b) << 70U);
+    BOOST_TEST(result == ((a * b) << 70U));
+
+    N acc(7);
+    acc += (lazy(a) * b) << 64U;
+    BOOST_TEST(acc == ((a * b) << 64U) + N(7));
+}
+
+BOOST_AUTO_TEST_CASE(destination_is_operand) {
+    const N a("123456789012345678901234567890");
+    const N b("98765432109876543210");
+
+    N x = a;
+    expr::assign(x, lazy(x) * x + b);
+    BOOST_TEST(x == a * a + b);
+
+    N y = a;
+    y += lazy(y) * b;
+    BOOST_TEST(y == a + a * b);
+
+    N z = a;
+    expr::assign(z, lazy(z) + b * b);
+    BOOST_TEST(z == a + b * b);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(z_expressions)
+
+BOOST_AUTO_TEST_CASE(mixed_signs) {
+    const Z a(-12345678901234567LL);
+    const Z b(98765432123LL);
+    const Z c(-5);
+    const Z d(77);
+
+    const Z result = lazy(a) * b - c * d + a;
+    BOOST_TEST(result == a * b - c * d + a);
+
+    const Z nested = lazy(a) - (lazy(b) - c * d);
+    BOOST_TEST(nested == a - (b - c * d));
+}
+
+BOOST_AUTO_TEST_CASE(accumulate_crosses_zero) {
+    const Z a(-12345678901234567LL);
+    const Z b(98765432123LL);
+
+    Z acc(5);
+    acc -= lazy(a) * b;
+    BOOST_TEST(acc == Z(5) - a * b);
+
+    acc += lazy(a) * b;
+    BOOST_TEST(acc == 5);
+
+    acc -= lazy(acc) * Z(1);
+    BOOST_TEST(acc == 0);
+    BOOST_TEST(acc.is_positive());
+}
+
+BOOST_AUTO_TEST_CASE(shifted_product_z) {
+    const Z a(-12345678901234567LL);
+    const Z b(98765432123LL);
+
+    const Z result = (lazy(a) * b) << 37U;
+    BOOST_TEST(result == ((a * b) << 37U));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_CASE(q_expression) {
+    const Q a("1/3");
+    const Q b("-2/5");
+    const Q c("7/2");
+
+    const Q result = lazy(a) * b + c - a;
+    BOOST_TEST(result == a * b + c - a);
+
+    Q acc = c;
+    acc -= lazy(a) * b;
+    BOOST_TEST(acc == c - a * b);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,93 @@
+// The jmaths library for C++
+// Copyright (C) 2025  Jasper de Smaele
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <boost/test/unit_test.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "all.hpp"
+
+using namespace jmaths;
+
+BOOST_AUTO_TEST_SUITE(fixed_base_pow_tests)
+
+BOOST_AUTO_TEST_CASE(matches_pow_mod) {
+    const N odd = (N(1) << 521U) - N(1);  // Mersenne prime
+    const N even("1000000000000000000000000000000000000000000");
+    const N g("31415926535897932384626433832795028841971693993751058209749445923");
+
+    const N exponents[] = {N(0),
+                           N(1),
+                           N(2),
+                           N(255),
+                           N("2718281828459045235360287471352662497757"),
+                           (N(1) << 256U) - N(1),
+                           N(1) << 255U};
+
+    for (const N & m : {odd, even}) {
+        // teeth and tables that split 256 bits evenly and unevenly
+        for (const auto & [teeth, tables] : {std::pair{1U, 1U},
+                                            std::pair{4U, 1U},
+                                            std::pair{5U, 3U},
+                                            std::pair{6U, 2U},
+                                            std::pair{8U, 4U}}) {
+            const fixed_base_pow g_pow(g, m, 256U, teeth, tables);
+
+            BOOST_TEST(g_pow.modulus() == m);
+            BOOST_TEST(g_pow.table_entries() == (std::size_t{1U} << teeth) * tables);
+
+            for (const N & e : exponents) { BOOST_TEST(g_pow.pow(e) == calc::pow_mod(g, e, m)); }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(longer_exponents) {
+    const N m("170141183460469231731687303715884105727");  // 2^127 - 1
+    const N g(3);
+    const fixed_base_pow g_pow(g, m, 64U);
+
+    const N e("123456789012345678901234567890123456789012345678901234567890");
+    BOOST_TEST(g_pow.pow(e) == calc::pow_mod(g, e, m));
+    BOOST_TEST(g_pow.pow(m - N(1)) == 1);  // Fermat
+}
+
+BOOST_AUTO_TEST_CASE(parameters_are_clamped) {
+    const N m(1000003);
+
+    const fixed_base_pow wide(N(2), m, 16U, 100U, 100U);
+    BOOST_TEST(wide.table_entries() == (std::size_t{1U} << fixed_base_pow<N>::max_teeth));
+    BOOST_TEST(wide.pow(N(1000002)) == 1);
+
+    const fixed_base_pow narrow(N(2), m, 20U, 0U, 0U);
+    BOOST_TEST(narrow.table_entries() == 2U);
+    BOOST_TEST(narrow.pow(N(1000002)) == 1);
+}
+
+BOOST_AUTO_TEST_CASE(small_limbs) {
+    using N8 = basic_N<std::uint8_t, std::uint16_t>;
+
+    const fixed_base_pow g_pow(N8(2), N8(1000000007), 30U, 3U, 2U);
+    BOOST_TEST(g_pow.pow(N8(1000000006)) == 1);
+    BOOST_TEST(g_pow.pow(N8(10)) == 1024);
+    BOOST_TEST(fixed_base_pow(N8(5), N8(1), 8U).pow(N8(3)) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(zero_modulus) {
+    BOOST_CHECK_THROW(fixed_base_pow(N(2), N(0), 64U), error::division_by_zero);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
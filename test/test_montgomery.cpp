@@ -0,0 +1,141 @@
+// The jmaths library for C++
+// Copyright (C) 2025  Jasper de Smaele
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <boost/test/unit_test.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "all.hpp"
+
+using namespace jmaths;
+
+namespace {
+
+// (a × b) mod m with the ordinary operators
+template <typename T> T mul_mod(const T & a, const T & b, const T & m) {
+    return (a * b / m).second;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(montgomery_tests)
+
+BOOST_AUTO_TEST_CASE(round_trip_and_product) {
+    const N m("170141183460469231731687303715884105727");  // 2^127 - 1
+    const montgomery_context ctx(m);
+
+    BOOST_TEST(ctx.limbs() * sizeof(N::limb_type) * 8U >= m.bits());
+    BOOST_TEST(ctx.modulus() == m);
+
+    const N a("98765432109876543210987654321");
+    const N b("12345678901234567890123456789012345678");
+
+    BOOST_TEST(ctx.from_montgomery(ctx.to_montgomery(a)) == a);
+    BOOST_TEST(ctx.from_montgomery(ctx.mul(ctx.to_montgomery(a), ctx.to_montgomery(b))) ==
+               mul_mod(a, b, m));
+
+    // to_montgomery reduces its argument
+    BOOST_TEST(ctx.from_montgomery(ctx.to_montgomery(m * N(5) + a)) == a);
+}
+
+BOOST_AUTO_TEST_CASE(limb_api) {
+    const N m = (N(1) << 256U) - N(189);  // odd, all limbs full
+    const montgomery_context ctx(m);
+
+    const N a = ctx.to_montgomery(N("1234567890123456789012345678901234567890"));
+    const N b = ctx.to_montgomery(m - N(1));
+
+    constexpr bitcount_t limb_bits = sizeof(N::limb_type) * 8U;
+    const N limb_mask = (N(1) << limb_bits) - N(1);
+
+    std::vector<N::limb_type> a_limbs(ctx.limbs()), b_limbs(ctx.limbs()), out(ctx.limbs());
+    for (std::size_t i = 0U; i < ctx.limbs(); ++i) {
+        a_limbs[i] = ((a >> (i * limb_bits)) & limb_mask).fits_into<N::limb_type>().value();
+        b_limbs[i] = ((b >> (i * limb_bits)) & limb_mask).fits_into<N::limb_type>().value();
+    }
+
+    ctx.mul(out, a_limbs, b_limbs);
+
+    N result;
+    for (std::size_t i = ctx.limbs(); i-- > 0U;) {
+        result = (result << limb_bits) + N(out[i]);
+    }
+
+    BOOST_TEST(result == ctx.mul(a, b));
+}
+
+BOOST_AUTO_TEST_CASE(pow_matches_binary_exponentiation) {
+    const N m("1000000000000000000000000000000000000000000000000000000000000000000000001");
+    const N base("31415926535897932384626433832795028841971693993751058209749445923");
+    const N exponent("2718281828459045235360287471352662497757");
+
+    N expected(1);
+    N b = (base / m).second;
+    for (bitcount_t i = 0U; i < exponent.bits(); ++i) {
+        if (exponent[i]) { expected = mul_mod(expected, b, m); }
+        b = mul_mod(b, b, m);
+    }
+
+    BOOST_TEST(montgomery_context(m).pow(base, exponent) == expected);
+    BOOST_TEST(calc::pow_mod(base, exponent, m) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(small_limbs) {
+    using N8 = basic_N<std::uint8_t, std::uint16_t>;
+
+    const N8 m("1000000007");
+    const montgomery_context ctx(m);
+
+    BOOST_TEST(ctx.pow(N8(2), N8(1000000006)) == 1);  // Fermat
+    BOOST_TEST(ctx.pow(N8(12345), N8(0)) == 1);
+    BOOST_TEST(montgomery_context(N8(1)).pow(N8(5), N8(3)) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(pow_ct_matches_pow) {
+    const N m = (N(1) << 1024U) + N(643);
+    const montgomery_context ctx(m);
+
+    const N base("31415926535897932384626433832795028841971693993751058209749445923");
+    const N exponents[] = {N(0),
+                           N(1),
+                           N(2),
+                           N(31),
+                           N(32),
+                           N("2718281828459045235360287471352662497757"),
+                           (N(1) << 1023U) - N(1),
+                           m - N(1)};
+
+    for (const N & exponent : exponents) {
+        BOOST_TEST(ctx.pow_ct(base, exponent) == ctx.pow(base, exponent));
+    }
+
+    // exponents longer than the public bound are processed in full
+    BOOST_TEST(ctx.pow_ct(base, m * m, 64U) == ctx.pow(base, m * m));
+    BOOST_TEST(calc::pow_mod_ct(base, exponents[5], m) == calc::pow_mod(base, exponents[5], m));
+
+    using N8 = basic_N<std::uint8_t, std::uint16_t>;
+    BOOST_TEST(montgomery_context(N8(1000000007)).pow_ct(N8(2), N8(1000000006)) == 1);
+    BOOST_TEST(montgomery_context(N8(1)).pow_ct(N8(5), N8(0)) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(invalid_modulus) {
+    BOOST_CHECK_THROW(montgomery_context(N(1000)), error::invalid_modulus);
+    BOOST_CHECK_THROW(montgomery_context(N(0)), error::division_by_zero);
+    BOOST_CHECK_THROW((void)calc::pow_mod_ct(N(3), N(5), N(1000)), error::invalid_modulus);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
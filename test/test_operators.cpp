@@ -318,4 +318,58 @@ BOOST_AUTO_TEST_CASE(equality_same_value_different_construction) {
     BOOST_TEST(a == c);
 }
 
+BOOST_AUTO_TEST_CASE(rvalue_operands_n) {
+    const N a("123456789012345678901234567890");
+    const N b("987654321098765432109876543210");
+
+    BOOST_TEST((N(a) + b) == a + b);
+    BOOST_TEST((a + N(b)) == a + b);
+    BOOST_TEST((N(a) + N(b)) == a + b);
+
+    BOOST_TEST((N(a) - b) == b - a);
+    BOOST_TEST((a - N(b)) == b - a);
+    BOOST_TEST((N(b) - N(a)) == b - a);
+
+    BOOST_TEST((N(a) * b) == a * b);
+    BOOST_TEST((a * N(b)) == a * b);
+    BOOST_TEST((N(a) & b) == (a & b));
+    BOOST_TEST((a | N(b)) == (a | b));
+    BOOST_TEST((N(a) ^ N(b)) == (a ^ b));
+
+    N c = a;
+    N chained = std::move(c) + b + a + b;
+    BOOST_TEST(chained == ((a + b) + (a + b)));
+}
+
+BOOST_AUTO_TEST_CASE(rvalue_operands_z) {
+    const Z a(-1234567890123LL);
+    const Z b(987654321);
+
+    BOOST_TEST((Z(a) + b) == a + b);
+    BOOST_TEST((a + Z(b)) == a + b);
+    BOOST_TEST((Z(a) - b) == a - b);
+    BOOST_TEST((a - Z(b)) == a - b);
+    BOOST_TEST((b - Z(a)) == b - a);
+    BOOST_TEST((Z(a) - Z(a)) == 0);
+    BOOST_TEST((a - Z(a)).is_positive());
+    BOOST_TEST((Z(a) * Z(b)) == a * b);
+    BOOST_TEST((a * Z(b)) == a * b);
+}
+
+BOOST_AUTO_TEST_CASE(rvalue_operands_q) {
+    const Q a("-1/2");
+    const Q b("3/4");
+    const Q c("-3/4");
+
+    BOOST_TEST((Q(a) + b) == a + b);
+    BOOST_TEST((a + Q(b)) == a + b);
+    BOOST_TEST((Q(a) - b) == Q("-5/4"));
+    BOOST_TEST((a - Q(b)) == Q("-5/4"));
+    BOOST_TEST((Q(a) - c) == Q("1/4"));
+    BOOST_TEST((c - Q(a)) == Q("-1/4"));
+    BOOST_TEST((a - Q(a)).is_positive());
+    BOOST_TEST((Q(a) * Q(b)) == a * b);
+    BOOST_TEST((Q(a) / b) == a / b);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
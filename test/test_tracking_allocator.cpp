@@ -0,0 +1,89 @@
+// The jmaths library for C++
+// Copyright (C) 2025  Jasper de Smaele
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <boost/test/unit_test.hpp>
+#include <cstdint>
+
+#include "all.hpp"
+
+using namespace jmaths;
+
+namespace {
+
+using tracked_N = basic_N<std::uint32_t, std::uint64_t, tracking_allocator<std::uint32_t>>;
+using tracked_Z = basic_Z<std::uint32_t, std::uint64_t, tracking_allocator<std::uint32_t>>;
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(tracking_allocator_tests)
+
+BOOST_AUTO_TEST_CASE(counts_allocations) {
+    reset_allocation_stats();
+    const auto before = get_allocation_stats();
+
+    {
+        const tracked_N a("123456789012345678901234567890");
+        const tracked_N b("98765432109876543210");
+        const tracked_N product = a * b;
+        BOOST_TEST(product.to_str() == "12193263113702179522496570642237463801111263526900");
+    }
+
+    const auto after = get_allocation_stats();
+
+    BOOST_TEST(after.allocations > before.allocations);
+    BOOST_TEST(after.allocations == after.deallocations);
+    BOOST_TEST(after.bytes_allocated == after.bytes_deallocated);
+    BOOST_TEST(after.live_bytes == before.live_bytes);
+    BOOST_TEST(after.peak_live_bytes > before.live_bytes);
+
+    std::uint64_t histogram_total = 0U;
+    for (const auto bucket : after.limb_histogram) {
+        histogram_total += bucket;
+    }
+    BOOST_TEST(histogram_total == after.allocations);
+}
+
+BOOST_AUTO_TEST_CASE(histogram_by_limb_count) {
+    reset_allocation_stats();
+
+    {
+        tracked_N n;
+        n.reserve(100U * 32U);  // exactly 100 limbs
+    }
+
+    const auto stats = get_allocation_stats();
+
+    BOOST_TEST(stats.allocations == 1U);
+    BOOST_TEST(stats.bytes_allocated == 100U * sizeof(std::uint32_t));
+    BOOST_TEST(stats.limb_histogram[7] == 1U);  // 64 <= 100 < 128
+}
+
+BOOST_AUTO_TEST_CASE(reset_keeps_live_bytes) {
+    tracked_Z kept("-123456789012345678901234567890");
+
+    reset_allocation_stats();
+    const auto stats = get_allocation_stats();
+
+    BOOST_TEST(stats.allocations == 0U);
+    BOOST_TEST(stats.live_bytes >= kept.abs().capacity() / 8U);
+    BOOST_TEST(stats.peak_live_bytes == stats.live_bytes);
+
+    kept *= kept;
+    BOOST_TEST(kept.is_positive());
+    BOOST_TEST(get_allocation_stats().allocations > 0U);
+}
+
+BOOST_AUTO_TEST_SUITE_END()